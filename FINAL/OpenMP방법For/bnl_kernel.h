@@ -0,0 +1,27 @@
+#ifndef BNL_KERNEL_H
+#define BNL_KERNEL_H
+
+#include <stdint.h>
+
+// ========================================
+// 블록 중첩 루프 조인 비교 커널
+// - Customer 블록의 custkey를 64바이트 정렬된 int64 배열로 모아 두고
+//   Order 키 하나를 키 4개(AVX2) / 8개(AVX-512)와 한 번에 비교
+// - 일치한 위치는 비교 마스크로 압축 저장 (AVX-512: compress store,
+//   AVX2: 마스크별 인덱스 표), SIMD를 쓸 수 없으면 스칼라 루프
+// ========================================
+
+// 압축 저장이 한 번에 최대 8개를 쓰므로 결과 인덱스 배열은 이만큼 여유를 둠
+#define BNL_KERNEL_PAD 8
+
+// capacity개를 담을 정렬된 키 배열 (실패 시 NULL, free()로 해제)
+int64_t* bnl_kernel_alloc_keys(int capacity);
+
+// 컴파일된 커널 종류 ("avx512", "avx2", "scalar")
+const char* bnl_kernel_name(void);
+
+// keys[0..count) 중 key와 같은 위치를 오름차순으로 out_idx에 기록하고 개수 반환
+// out_idx는 count + BNL_KERNEL_PAD개 이상이어야 함
+int bnl_kernel_match(const int64_t *keys, int count, int64_t key, int *out_idx);
+
+#endif
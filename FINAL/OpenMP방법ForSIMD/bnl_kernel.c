@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "bnl_kernel.h"
+#if defined(__AVX2__) || (defined(__AVX512F__) && defined(__AVX512VL__))
+#include <immintrin.h>
+#endif
+
+#define BNL_KEY_ALIGN 64
+
+int64_t* bnl_kernel_alloc_keys(int capacity) {
+    // aligned_alloc은 크기가 정렬 단위의 배수여야 함
+    size_t bytes = sizeof(int64_t) * (size_t)capacity;
+    bytes = (bytes + BNL_KEY_ALIGN - 1) / BNL_KEY_ALIGN * BNL_KEY_ALIGN;
+    int64_t *keys = (int64_t *)aligned_alloc(BNL_KEY_ALIGN, bytes > 0 ? bytes : BNL_KEY_ALIGN);
+    if (!keys) {
+        fprintf(stderr, "키 배열 할당 실패\n");
+    }
+    return keys;
+}
+
+#if defined(__AVX512F__) && defined(__AVX512VL__)
+
+const char* bnl_kernel_name(void) {
+    return "avx512";
+}
+
+int bnl_kernel_match(const int64_t *keys, int count, int64_t key, int *out_idx) {
+    const __m512i needle = _mm512_set1_epi64(key);
+    const __m256i step = _mm256_set1_epi32(8);
+    __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    int matches = 0;
+    int i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        __mmask8 mask = _mm512_cmpeq_epi64_mask(_mm512_load_si512((const void *)(keys + i)), needle);
+        _mm256_mask_compressstoreu_epi32(out_idx + matches, mask, index);
+        matches += __builtin_popcount(mask);
+        index = _mm256_add_epi32(index, step);
+    }
+    for (; i < count; i++) {
+        if (keys[i] == key) out_idx[matches++] = i;
+    }
+    return matches;
+}
+
+#elif defined(__AVX2__)
+
+// 4비트 비교 마스크 → 일치한 위치를 앞으로 모은 인덱스 (남는 칸은 사용하지 않음)
+static const int32_t compress_table[16][4] = {
+    {0, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0},
+    {2, 0, 0, 0}, {0, 2, 0, 0}, {1, 2, 0, 0}, {0, 1, 2, 0},
+    {3, 0, 0, 0}, {0, 3, 0, 0}, {1, 3, 0, 0}, {0, 1, 3, 0},
+    {2, 3, 0, 0}, {0, 2, 3, 0}, {1, 2, 3, 0}, {0, 1, 2, 3},
+};
+
+const char* bnl_kernel_name(void) {
+    return "avx2";
+}
+
+int bnl_kernel_match(const int64_t *keys, int count, int64_t key, int *out_idx) {
+    const __m256i needle = _mm256_set1_epi64x(key);
+    int matches = 0;
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        __m256i eq = _mm256_cmpeq_epi64(_mm256_load_si256((const __m256i *)(keys + i)), needle);
+        int mask = _mm256_movemask_pd(_mm256_castsi256_pd(eq));
+        __m128i positions = _mm_add_epi32(_mm_loadu_si128((const __m128i *)compress_table[mask]),
+                                          _mm_set1_epi32(i));
+        _mm_storeu_si128((__m128i *)(out_idx + matches), positions);
+        matches += __builtin_popcount(mask);
+    }
+    for (; i < count; i++) {
+        if (keys[i] == key) out_idx[matches++] = i;
+    }
+    return matches;
+}
+
+#else
+
+const char* bnl_kernel_name(void) {
+    return "scalar";
+}
+
+int bnl_kernel_match(const int64_t *keys, int count, int64_t key, int *out_idx) {
+    int matches = 0;
+    for (int i = 0; i < count; i++) {
+        if (keys[i] == key) out_idx[matches++] = i;
+    }
+    return matches;
+}
+
+#endif
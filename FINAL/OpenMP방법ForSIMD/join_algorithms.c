@@ -4,6 +4,7 @@
 #include "join_algorithms.h"
 #include "disk_reader.h"
 #include "disk_save.h"
+#include "bnl_kernel.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -15,6 +16,7 @@
 // ========================================
 // OpenMP 기반 병렬 블록 중첩 루프 조인 (결과 저장)
 // - 전통적인 2중 for문 방식: Customer와 Order를 직접 비교
+// - Customer 키를 연속 배열로 모아 SIMD 커널로 비교 (bnl_kernel.h)
 // - 독립 스캔 아키텍처: 각 스레드가 독립적으로 파일 I/O 수행
 // - Customer 데이터 분할: 각 스레드가 자신의 파트만 처리
 // - Order 데이터 중복 스캔: 각 스레드가 전체 Order 파일을 독립적으로 읽음
@@ -49,6 +51,7 @@ long disk_parallel_block_nested_loop_join_save(const char *customer_file, const
 
     printf("총 Customer 레코드: %ld개\n", total_lines);
     printf("%d개 스레드로 병렬 처리 시작 (결과 저장 모드)...\n", num_threads);
+    printf("비교 커널: %s\n", bnl_kernel_name());
     printf("출력 파일: %s\n\n", output_file);
 
     // 각 스레드의 작업 범위 계산 (균등 분배)
@@ -104,6 +107,21 @@ long disk_parallel_block_nested_loop_join_save(const char *customer_file, const
             continue;
         }
 
+        // 비교 커널 입력: Customer 블록의 키 배열 + 일치 위치 배열
+        int64_t *cust_keys = bnl_kernel_alloc_keys(max_records);
+        int *match_idx = (int *)malloc(sizeof(int) * (max_records + BNL_KERNEL_PAD));
+
+        if (!cust_keys || !match_idx) {
+            fprintf(stderr, "[Thread %d] 키 배열 할당 실패\n", thread_id);
+            free(cust_keys);
+            free(match_idx);
+            free(cust_buffer);
+            free(order_buffer);
+            disk_reader_close(cust_reader);
+            disk_reader_close(order_reader);
+            continue;
+        }
+
         // ========================================
         // 3.3 결과 버퍼 생성
         // ========================================
@@ -111,6 +129,8 @@ long disk_parallel_block_nested_loop_join_save(const char *customer_file, const
         ResultBuffer *result_buf = result_buffer_create(output_file, 10000);
         if (!result_buf) {
             fprintf(stderr, "[Thread %d] 결과 버퍼 할당 실패\n", thread_id);
+            free(cust_keys);
+            free(match_idx);
             free(cust_buffer);
             free(order_buffer);
             disk_reader_close(cust_reader);
@@ -158,6 +178,11 @@ long disk_parallel_block_nested_loop_join_save(const char *customer_file, const
 
             if (cust_count == 0) break;
 
+            // 260바이트 레코드에 흩어진 custkey를 연속 배열로 추출
+            for (int c = 0; c < cust_count; c++) {
+                cust_keys[c] = cust_buffer[c].custkey;
+            }
+
             // ========================================
             // 3.5.2 Orders 테이블 전체 스캔 및 조인 수행 (2중 루프)
             // ========================================
@@ -186,14 +211,13 @@ long disk_parallel_block_nested_loop_join_save(const char *customer_file, const
                 // ========================================
                 // 3.5.3 2중 루프 조인 수행 (전통적인 nested loop join)
                 // ========================================
-                // Customer 블록의 각 레코드와 Order 블록의 각 레코드를 직접 비교
-                for (int c = 0; c < cust_count; c++) {
-                    for (int o = 0; o < order_count; o++) {
-                        if (cust_buffer[c].custkey == order_buffer[o].custkey) {
-                            // 매칭 성공: Customer와 Order 정보를 결과 버퍼에 추가
-                            result_buffer_add(result_buf, &cust_buffer[c], &order_buffer[o]);
-                            result_count++;
-                        }
+                // Order 레코드마다 Customer 블록의 모든 키와 비교 (커널이 4/8개씩 비교)
+                for (int o = 0; o < order_count; o++) {
+                    int matches = bnl_kernel_match(cust_keys, cust_count, order_buffer[o].custkey, match_idx);
+                    for (int m = 0; m < matches; m++) {
+                        // 매칭 성공: Customer와 Order 정보를 결과 버퍼에 추가
+                        result_buffer_add(result_buf, &cust_buffer[match_idx[m]], &order_buffer[o]);
+                        result_count++;
                     }
                 }
             }
@@ -206,6 +230,8 @@ long disk_parallel_block_nested_loop_join_save(const char *customer_file, const
         // ========================================
         // 남은 결과 플러시 및 모든 리소스 해제
         result_buffer_destroy(result_buf);
+        free(cust_keys);
+        free(match_idx);
         free(cust_buffer);
         free(order_buffer);
         disk_reader_close(cust_reader);
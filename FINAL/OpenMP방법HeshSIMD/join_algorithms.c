@@ -4,6 +4,7 @@
 #include "join_algorithms.h"
 #include "disk_reader.h"
 #include "disk_save.h"
+#include "swiss_table.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -18,6 +19,7 @@
 // - Customer 데이터 분할: 각 스레드가 자신의 파트만 처리
 // - Order 데이터 중복 스캔: 각 스레드가 전체 Order 파일을 독립적으로 읽음
 // - 해시 테이블을 통한 O(1) 탐색으로 빠른 조인 수행
+// - 해시 테이블은 SIMD 태그 비교를 쓰는 그룹 테이블 (swiss_table.h)
 // ========================================
 
 long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, const char *order_file,
@@ -107,8 +109,8 @@ long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, c
         // ========================================
         // 3.3 해시 테이블 및 결과 버퍼 생성
         // ========================================
-        // 해시 테이블 생성: Customer 키를 O(1)으로 탐색하기 위한 자료구조
-        HashNode **hash_table = (HashNode **)calloc(HASH_SIZE, sizeof(HashNode *));
+        // 해시 테이블 생성: Customer 블록 최대 크기만큼 슬롯을 미리 확보
+        SwissTable *hash_table = swiss_table_create((size_t)max_records);
         if (!hash_table) {
             fprintf(stderr, "[Thread %d] 해시 테이블 할당 실패\n", thread_id);
             free(cust_buffer);
@@ -122,7 +124,7 @@ long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, c
         ResultBuffer *result_buf = result_buffer_create(output_file, 10000);
         if (!result_buf) {
             fprintf(stderr, "[Thread %d] 결과 버퍼 할당 실패\n", thread_id);
-            free(hash_table);
+            swiss_table_destroy(hash_table);
             free(cust_buffer);
             free(order_buffer);
             disk_reader_close(cust_reader);
@@ -174,15 +176,9 @@ long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, c
             // 3.5.2 해시 테이블 구축 (Customer 데이터를 인덱싱)
             // ========================================
             // 읽은 Customer 블록을 해시 테이블에 삽입하여 빠른 탐색 준비
+            // (블록 크기가 max_records 이하이므로 삽입은 실패하지 않음)
             for (int j = 0; j < cust_count; j++) {
-                long key = cust_buffer[j].custkey;
-                int hash = key % HASH_SIZE;
-
-                HashNode *node = (HashNode *)malloc(sizeof(HashNode));
-                node->custkey = key;
-                node->customer_idx = j;
-                node->next = hash_table[hash];
-                hash_table[hash] = node;
+                swiss_table_insert(hash_table, cust_buffer[j].custkey, j);
             }
 
             // ========================================
@@ -214,37 +210,27 @@ long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, c
                 // 3.5.4 해시 테이블 탐색 및 결과 매칭/저장
                 // ========================================
                 // 각 Order 레코드에 대해 해시 테이블에서 Customer 매칭 탐색
+                // 그룹 태그 16개를 한 번에 비교하고, 태그가 같은 슬롯만 키 비교
                 for (int j = 0; j < order_count; j++) {
-                    long key = order_buffer[j].custkey;
-                    int hash = key % HASH_SIZE;
-
-                    HashNode *node = hash_table[hash];
-                    while (node) {
-                        if (node->custkey == key) {
-                            // 매칭 성공: Customer와 Order 정보를 결과 버퍼에 추가
-                            result_buffer_add(result_buf,
-                                            &cust_buffer[node->customer_idx],
-                                            &order_buffer[j]);
-                            result_count++;
-                        }
-                        node = node->next;
+                    SwissCursor cursor;
+                    swiss_table_cursor_init(hash_table, order_buffer[j].custkey, &cursor);
+
+                    int customer_idx;
+                    while ((customer_idx = swiss_table_find_next(hash_table, &cursor)) >= 0) {
+                        // 매칭 성공: Customer와 Order 정보를 결과 버퍼에 추가
+                        result_buffer_add(result_buf,
+                                        &cust_buffer[customer_idx],
+                                        &order_buffer[j]);
+                        result_count++;
                     }
                 }
             }
 
             // ========================================
-            // 3.5.5 해시 테이블 정리 (메모리 누수 방지)
+            // 3.5.5 해시 테이블 초기화 (다음 블록 준비)
             // ========================================
-            // 현재 블록의 해시 테이블을 완전히 해제하여 다음 블록 준비
-            for (int j = 0; j < HASH_SIZE; j++) {
-                HashNode *node = hash_table[j];
-                while (node) {
-                    HashNode *temp = node;
-                    node = node->next;
-                    free(temp);
-                }
-                hash_table[j] = NULL;
-            }
+            // 태그만 비워 다음 블록에서 테이블 재사용
+            swiss_table_clear(hash_table);
         }
 
         printf("[Thread %d] 완료: %ld건 매칭 및 저장\n", thread_id, result_count);
@@ -254,7 +240,7 @@ long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, c
         // ========================================
         // 남은 결과 플러시 및 모든 리소스 해제
         result_buffer_destroy(result_buf);
-        free(hash_table);
+        swiss_table_destroy(hash_table);
         free(cust_buffer);
         free(order_buffer);
         disk_reader_close(cust_reader);
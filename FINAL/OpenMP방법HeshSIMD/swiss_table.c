@@ -0,0 +1,73 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "swiss_table.h"
+
+SwissTable* swiss_table_create(size_t expected) {
+    SwissTable *table = (SwissTable *)malloc(sizeof(SwissTable));
+    if (!table) {
+        fprintf(stderr, "해시 테이블 할당 실패\n");
+        return NULL;
+    }
+
+    // 적재율 7/8 이하가 되는 최소 그룹 수 (2의 거듭제곱)
+    size_t needed = expected * SWISS_MAX_LOAD_DEN / SWISS_MAX_LOAD_NUM + 1;
+    size_t groups = 1;
+    while (groups * SWISS_GROUP_SIZE < needed) {
+        groups <<= 1;
+    }
+
+    table->capacity = groups * SWISS_GROUP_SIZE;
+    table->group_mask = groups - 1;
+    table->size = 0;
+    table->tags = (uint8_t *)malloc(table->capacity);
+    table->keys = (long *)malloc(sizeof(long) * table->capacity);
+    table->values = (int *)malloc(sizeof(int) * table->capacity);
+
+    if (!table->tags || !table->keys || !table->values) {
+        fprintf(stderr, "해시 테이블 슬롯 할당 실패 (%zu개)\n", table->capacity);
+        swiss_table_destroy(table);
+        return NULL;
+    }
+
+    swiss_table_clear(table);
+    return table;
+}
+
+void swiss_table_destroy(SwissTable *table) {
+    if (table) {
+        free(table->tags);
+        free(table->keys);
+        free(table->values);
+        free(table);
+    }
+}
+
+// 태그만 비우면 되므로 블록마다 capacity 바이트만 초기화
+void swiss_table_clear(SwissTable *table) {
+    memset(table->tags, SWISS_EMPTY, table->capacity);
+    table->size = 0;
+}
+
+int swiss_table_insert(SwissTable *table, long key, int value) {
+    if ((table->size + 1) * SWISS_MAX_LOAD_DEN > table->capacity * SWISS_MAX_LOAD_NUM) {
+        return -1;
+    }
+
+    uint64_t hash = swiss_hash(key);
+    size_t group = (size_t)(hash >> 7) & table->group_mask;
+
+    for (size_t step = 0; step <= table->group_mask; step++) {
+        uint32_t empty = swiss_group_match(table->tags + group * SWISS_GROUP_SIZE, SWISS_EMPTY);
+        if (empty) {
+            size_t slot = group * SWISS_GROUP_SIZE + (size_t)__builtin_ctz(empty);
+            table->tags[slot] = (uint8_t)(hash & 0x7F);
+            table->keys[slot] = key;
+            table->values[slot] = value;
+            table->size++;
+            return 0;
+        }
+        group = (group + step + 1) & table->group_mask;
+    }
+    return -1;
+}
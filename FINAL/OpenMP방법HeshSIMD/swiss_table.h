@@ -0,0 +1,104 @@
+#ifndef SWISS_TABLE_H
+#define SWISS_TABLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>  // _mm_cmpeq_epi8, _mm_movemask_epi8
+#endif
+
+// ========================================
+// SIMD 그룹 해시 테이블 (Swiss table 방식)
+// - 슬롯 16개를 한 그룹으로 묶고, 그룹마다 1바이트 태그 16개를 따로 저장
+//   (태그: 해시 하위 7비트, 0x80 = 빈 슬롯)
+// - 탐색 시 그룹의 태그 16개를 SSE2 비교 한 번으로 걸러낸 뒤
+//   태그가 일치한 슬롯의 키만 비교
+// - 같은 키를 여러 번 넣을 수 있음 (중복 Customer 키도 모두 매칭)
+// ========================================
+
+#define SWISS_GROUP_SIZE 16
+#define SWISS_EMPTY 0x80
+#define SWISS_MAX_LOAD_NUM 7   // 최대 적재율 7/8
+#define SWISS_MAX_LOAD_DEN 8
+
+typedef struct {
+    uint8_t *tags;         // 그룹별 태그 16개 (capacity 바이트)
+    long *keys;            // 슬롯별 키
+    int *values;           // 슬롯별 값 (Customer 버퍼 인덱스)
+    size_t group_mask;     // 그룹 수 - 1 (그룹 수는 2의 거듭제곱)
+    size_t capacity;       // 전체 슬롯 수
+    size_t size;
+} SwissTable;
+
+// 한 키의 탐색 위치 (swiss_table_find_next를 반복 호출해 중복 키를 모두 찾음)
+typedef struct {
+    long key;
+    size_t group;
+    size_t step;
+    uint32_t mask;         // 현재 그룹에서 남은 태그 일치 비트
+    uint8_t tag;
+    int last_group;        // 현재 그룹에 빈 슬롯이 있으면 다음 그룹은 볼 필요 없음
+} SwissCursor;
+
+// expected개를 적재율 7/8 이하로 담을 수 있는 테이블 생성 (실패 시 NULL)
+SwissTable* swiss_table_create(size_t expected);
+void swiss_table_destroy(SwissTable *table);
+void swiss_table_clear(SwissTable *table);
+// 공간이 없으면 -1
+int swiss_table_insert(SwissTable *table, long key, int value);
+
+static inline uint64_t swiss_hash(long key) {
+    uint64_t hash = (uint64_t)key * 0x9E3779B97F4A7C15ULL;
+    return hash ^ (hash >> 29);
+}
+
+// 그룹의 태그 중 tag와 같은 것 / 빈 슬롯의 비트 마스크
+static inline uint32_t swiss_group_match(const uint8_t *group_tags, uint8_t tag) {
+#if defined(__SSE2__)
+    __m128i tags = _mm_loadu_si128((const __m128i *)group_tags);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(tags, _mm_set1_epi8((char)tag)));
+#else
+    uint32_t mask = 0;
+    for (int i = 0; i < SWISS_GROUP_SIZE; i++) {
+        if (group_tags[i] == tag) mask |= 1u << i;
+    }
+    return mask;
+#endif
+}
+
+static inline void swiss_table_cursor_init(const SwissTable *table, long key, SwissCursor *cursor) {
+    uint64_t hash = swiss_hash(key);
+    cursor->key = key;
+    cursor->tag = (uint8_t)(hash & 0x7F);
+    cursor->group = (size_t)(hash >> 7) & table->group_mask;
+    cursor->step = 0;
+    const uint8_t *group_tags = table->tags + cursor->group * SWISS_GROUP_SIZE;
+    cursor->mask = swiss_group_match(group_tags, cursor->tag);
+    cursor->last_group = swiss_group_match(group_tags, SWISS_EMPTY) != 0;
+}
+
+// 다음으로 일치하는 슬롯의 값을 반환 (더 없으면 -1)
+static inline int swiss_table_find_next(const SwissTable *table, SwissCursor *cursor) {
+    while (1) {
+        while (cursor->mask) {
+            int bit = __builtin_ctz(cursor->mask);
+            cursor->mask &= cursor->mask - 1;
+            size_t slot = cursor->group * SWISS_GROUP_SIZE + (size_t)bit;
+            if (table->keys[slot] == cursor->key) {
+                return table->values[slot];
+            }
+        }
+        if (cursor->last_group || cursor->step > table->group_mask) {
+            return -1;
+        }
+
+        // 삼각수 간격으로 다음 그룹 (그룹 수가 2의 거듭제곱이면 모든 그룹을 한 번씩 방문)
+        cursor->step++;
+        cursor->group = (cursor->group + cursor->step) & table->group_mask;
+        const uint8_t *group_tags = table->tags + cursor->group * SWISS_GROUP_SIZE;
+        cursor->mask = swiss_group_match(group_tags, cursor->tag);
+        cursor->last_group = swiss_group_match(group_tags, SWISS_EMPTY) != 0;
+    }
+}
+
+#endif
@@ -0,0 +1,276 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <sys/time.h>
+#include "join_algorithms.h"
+#include "disk_reader.h"
+#include "hash_functions.h"
+
+// ========================================
+// 해시 함수 비교 벤치마크
+// - 조인과 같은 체이닝 해시 테이블(HASH_SIZE 버킷)에 Customer 키를 넣고 Order 키로 탐색
+// - 함수별 체인 길이 분포, Build/Probe 처리량(M keys/s) 출력
+// - 키 분포: 실제 TPC-H 키, Zipf 편향 탐색 키, HASH_SIZE 간격 키(모듈로에 불리)
+// ========================================
+
+#define BENCH_REPEAT 5     // Build/Probe 반복 횟수 (작은 데이터에서 타이머 오차 완화)
+#define ZIPF_SKEW 1.0
+#define CHAIN_HIST_BINS 7  // 0, 1, 2, 3, 4, 5-8, 9+
+#define STRIDE_GROUP 64    // 간격 키: 나머지(key % HASH_SIZE)가 같은 키 수
+
+typedef uint32_t (*HashBucketFn)(long key, uint32_t size);
+
+typedef struct {
+    const char *name;
+    HashBucketFn fn;
+} HashFunctionEntry;
+
+static const HashFunctionEntry hash_functions[HASH_FN_COUNT] = {
+    { "modulo-prime",   hash_fn_modulo },
+    { "fnv-1a",         hash_fn_fnv1a },
+    { "multiply-shift", hash_fn_multiply_shift },
+    { "murmur-fmix64",  hash_fn_murmur },
+    { "crc32c",         hash_fn_crc32c },
+};
+
+// 벤치마크용 체이닝 테이블 (노드는 미리 할당한 배열에서 사용)
+typedef struct {
+    int *heads;      // 버킷별 첫 노드 인덱스 (-1: 비어 있음)
+    int *next;       // 노드별 다음 노드 인덱스
+    long *keys;      // 노드별 키
+} BenchTable;
+
+static double get_time_sec(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+// 파일에서 custkey만 배열로 읽기 (실패 시 -1)
+static long load_custkeys(const char *filename, const char *type, long **out) {
+    DiskReader *reader = disk_reader_open(filename, type);
+    if (!reader) return -1;
+
+    long capacity = 1 << 16;
+    long count = 0;
+    long *keys = (long *)malloc(sizeof(long) * capacity);
+    CustomerRecord *cust = (CustomerRecord *)malloc(sizeof(CustomerRecord));
+    OrderRecord *ord = (OrderRecord *)malloc(sizeof(OrderRecord));
+    if (!keys || !cust || !ord) {
+        fprintf(stderr, "키 배열 할당 실패\n");
+        free(keys);
+        free(cust);
+        free(ord);
+        disk_reader_close(reader);
+        return -1;
+    }
+
+    int is_customer = (type[0] == 'c');
+    while (is_customer ? disk_reader_read_customer(reader, cust) : disk_reader_read_order(reader, ord)) {
+        if (count == capacity) {
+            capacity *= 2;
+            long *grown = (long *)realloc(keys, sizeof(long) * capacity);
+            if (!grown) {
+                fprintf(stderr, "키 배열 확장 실패\n");
+                free(keys);
+                keys = NULL;
+                break;
+            }
+            keys = grown;
+        }
+        keys[count++] = is_customer ? cust->custkey : ord->custkey;
+    }
+
+    free(cust);
+    free(ord);
+    disk_reader_close(reader);
+    if (!keys) return -1;
+    *out = keys;
+    return count;
+}
+
+// 결정적 의사 난수 (xorshift64*)
+static uint64_t next_random(uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+// Customer 키 중에서 Zipf(ZIPF_SKEW) 분포로 탐색 키 생성 (실패 시 -1)
+static int make_zipf_probe(const long *build_keys, long build_count, long *probe_keys, long probe_count) {
+    double *cdf = (double *)malloc(sizeof(double) * build_count);
+    if (!cdf) {
+        fprintf(stderr, "Zipf 분포 할당 실패\n");
+        return -1;
+    }
+
+    double sum = 0.0;
+    for (long i = 0; i < build_count; i++) {
+        sum += 1.0 / pow((double)(i + 1), ZIPF_SKEW);
+        cdf[i] = sum;
+    }
+
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (long i = 0; i < probe_count; i++) {
+        double u = (double)(next_random(&state) >> 11) / (double)(1ULL << 53) * sum;
+        long lo = 0;
+        long hi = build_count - 1;
+        while (lo < hi) {
+            long mid = lo + (hi - lo) / 2;
+            if (cdf[mid] < u) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        probe_keys[i] = build_keys[lo];
+    }
+
+    free(cdf);
+    return 0;
+}
+
+static void bench_one(const HashFunctionEntry *entry, BenchTable *table,
+                      const long *build_keys, long build_count,
+                      const long *probe_keys, long probe_count) {
+    // Build (BENCH_REPEAT회 반복, 마지막 결과를 분포 측정과 탐색에 사용)
+    double start = get_time_sec();
+    for (int r = 0; r < BENCH_REPEAT; r++) {
+        for (int b = 0; b < HASH_SIZE; b++) {
+            table->heads[b] = -1;
+        }
+        for (long i = 0; i < build_count; i++) {
+            uint32_t hash = entry->fn(build_keys[i], HASH_SIZE);
+            table->keys[i] = build_keys[i];
+            table->next[i] = table->heads[hash];
+            table->heads[hash] = (int)i;
+        }
+    }
+    double build_time = get_time_sec() - start;
+
+    // 체인 길이 분포
+    long hist[CHAIN_HIST_BINS] = {0};
+    long max_chain = 0;
+    long used_buckets = 0;
+    double sum_squares = 0.0;
+    for (int b = 0; b < HASH_SIZE; b++) {
+        long length = 0;
+        for (int n = table->heads[b]; n >= 0; n = table->next[n]) {
+            length++;
+        }
+        if (length > 0) used_buckets++;
+        if (length > max_chain) max_chain = length;
+        sum_squares += (double)length * length;
+
+        int bin = (length <= 4) ? (int)length : (length <= 8 ? 5 : 6);
+        hist[bin]++;
+    }
+
+    // Probe (BENCH_REPEAT회 반복, 매칭 수는 최적화 방지용 검증 값)
+    long matches = 0;
+    long visited = 0;
+    start = get_time_sec();
+    for (int r = 0; r < BENCH_REPEAT; r++) {
+        for (long i = 0; i < probe_count; i++) {
+            long key = probe_keys[i];
+            for (int n = table->heads[entry->fn(key, HASH_SIZE)]; n >= 0; n = table->next[n]) {
+                visited++;
+                if (table->keys[n] == key) matches++;
+            }
+        }
+    }
+    double probe_time = get_time_sec() - start;
+
+    printf("  %-15s %6ld %8.2f %5ld %7.3f %7.3f  %6ld %6ld %6ld %6ld %6ld %6ld %6ld %9.1f %9.1f %ld\n",
+           entry->name,
+           used_buckets,
+           build_count > 0 ? (double)build_count / used_buckets : 0.0,
+           max_chain,
+           build_count > 0 ? sum_squares / build_count : 0.0,
+           probe_count > 0 ? (double)visited / ((double)probe_count * BENCH_REPEAT) : 0.0,
+           hist[0], hist[1], hist[2], hist[3], hist[4], hist[5], hist[6],
+           build_time > 0 ? build_count * (double)BENCH_REPEAT / build_time / 1e6 : 0.0,
+           probe_time > 0 ? probe_count * (double)BENCH_REPEAT / probe_time / 1e6 : 0.0,
+           matches / BENCH_REPEAT);
+}
+
+static void bench_distribution(const char *label, BenchTable *table,
+                               const long *build_keys, long build_count,
+                               const long *probe_keys, long probe_count) {
+    printf("\n[%s] Build %ld개, Probe %ld개, 버킷 %d개\n", label, build_count, probe_count, HASH_SIZE);
+    printf("  %-15s %6s %8s %5s %7s %7s  %6s %6s %6s %6s %6s %6s %6s %9s %9s %s\n",
+           "function", "used", "avg_len", "max", "E[len]", "visits",
+           "len0", "len1", "len2", "len3", "len4", "5-8", "9+",
+           "build_M/s", "probe_M/s", "matches");
+    for (int f = 0; f < HASH_FN_COUNT; f++) {
+        bench_one(&hash_functions[f], table, build_keys, build_count, probe_keys, probe_count);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const char *customer_file = argc > 1 ? argv[1] : "../tbl/customer.tbl";
+    const char *order_file = argc > 2 ? argv[2] : "../tbl/orders.tbl";
+
+    long *build_keys = NULL;
+    long *probe_keys = NULL;
+    long build_count = load_custkeys(customer_file, "customer", &build_keys);
+    if (build_count <= 0) {
+        fprintf(stderr, "Customer 키 읽기 실패: %s\n", customer_file);
+        return 1;
+    }
+    long probe_count = load_custkeys(order_file, "order", &probe_keys);
+    if (probe_count <= 0) {
+        fprintf(stderr, "Order 키 읽기 실패: %s\n", order_file);
+        free(build_keys);
+        return 1;
+    }
+
+    BenchTable table;
+    table.heads = (int *)malloc(sizeof(int) * HASH_SIZE);
+    table.next = (int *)malloc(sizeof(int) * build_count);
+    table.keys = (long *)malloc(sizeof(long) * build_count);
+    long *skewed_keys = (long *)malloc(sizeof(long) * probe_count);
+    long *strided_build = (long *)malloc(sizeof(long) * build_count);
+    long *strided_probe = (long *)malloc(sizeof(long) * probe_count);
+    if (!table.heads || !table.next || !table.keys || !skewed_keys || !strided_build || !strided_probe) {
+        fprintf(stderr, "벤치마크 메모리 할당 실패\n");
+        return 1;
+    }
+
+    printf("==============================================\n");
+    printf("Hash Function Benchmark (조인 기본값: %s)\n", HASH_FUNCTION_NAME);
+    printf("==============================================\n");
+    printf("  used: 사용 버킷 수, avg_len: 사용 버킷 평균 체인 길이, max: 최대 체인 길이\n");
+    printf("  E[len]: 키 하나가 속한 체인의 기대 길이, visits: 탐색당 방문 노드 수\n");
+    printf("  len0..9+: 체인 길이별 버킷 수\n");
+
+    bench_distribution("실제 custkey", &table, build_keys, build_count, probe_keys, probe_count);
+
+    if (make_zipf_probe(build_keys, build_count, skewed_keys, probe_count) == 0) {
+        bench_distribution("Zipf 편향 탐색 키", &table, build_keys, build_count, skewed_keys, probe_count);
+    }
+
+    // k -> (k % STRIDE_GROUP) * HASH_SIZE + k / STRIDE_GROUP: 키는 서로 다르게 유지되지만
+    // 나머지가 같은 키가 STRIDE_GROUP개씩 생겨 모듈로 해시의 체인이 길어짐
+    for (long i = 0; i < build_count; i++) {
+        strided_build[i] = (build_keys[i] % STRIDE_GROUP) * HASH_SIZE + build_keys[i] / STRIDE_GROUP;
+    }
+    for (long i = 0; i < probe_count; i++) {
+        strided_probe[i] = (probe_keys[i] % STRIDE_GROUP) * HASH_SIZE + probe_keys[i] / STRIDE_GROUP;
+    }
+    bench_distribution("HASH_SIZE 간격 키", &table, strided_build, build_count, strided_probe, probe_count);
+
+    free(table.heads);
+    free(table.next);
+    free(table.keys);
+    free(skewed_keys);
+    free(strided_build);
+    free(strided_probe);
+    free(build_keys);
+    free(probe_keys);
+    return 0;
+}
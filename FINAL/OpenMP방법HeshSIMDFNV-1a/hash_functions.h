@@ -0,0 +1,99 @@
+#ifndef HASH_FUNCTIONS_H
+#define HASH_FUNCTIONS_H
+
+#include <stdint.h>
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>  // _mm_crc32_u64
+#endif
+
+// ========================================
+// 해시 함수 모음 (컴파일 시 선택)
+// - 조인은 HASH_FUNCTION으로 고른 hash_bucket()만 사용
+//   예: make HASH_FUNCTION=HASH_FN_CRC32C
+// - hash_bench는 아래 함수를 모두 비교
+// - 나머지 연산을 쓰는 modulo를 제외하면, 32비트 해시를 곱셈으로
+//   [0, size) 범위에 축소 (size가 2의 거듭제곱이 아니어도 됨)
+// ========================================
+
+#define HASH_FN_MODULO         0  // key % size (size는 소수)
+#define HASH_FN_FNV1A          1  // 키 8바이트에 대한 FNV-1a
+#define HASH_FN_MULTIPLY_SHIFT 2  // 황금비 상수 곱셈 후 상위 32비트
+#define HASH_FN_MURMUR         3  // MurmurHash3 fmix64 finalizer
+#define HASH_FN_CRC32C         4  // SSE4.2 crc32 명령어 (미지원 시 소프트웨어)
+#define HASH_FN_COUNT          5
+
+#ifndef HASH_FUNCTION
+#define HASH_FUNCTION HASH_FN_FNV1A
+#endif
+
+// 32비트 해시 값을 [0, size) 범위로 축소 (나머지 연산 없이 곱셈 한 번)
+static inline uint32_t hash_reduce(uint32_t hash, uint32_t size) {
+    return (uint32_t)(((uint64_t)hash * size) >> 32);
+}
+
+static inline uint32_t hash_fn_modulo(long key, uint32_t size) {
+    return (uint32_t)((uint64_t)key % size);
+}
+
+static inline uint32_t hash_fn_fnv1a(long key, uint32_t size) {
+    uint64_t value = (uint64_t)key;
+    uint64_t hash = 14695981039346656037ULL;
+    for (int i = 0; i < 8; i++) {
+        hash ^= value & 0xFF;
+        hash *= 1099511628211ULL;
+        value >>= 8;
+    }
+    return hash_reduce((uint32_t)(hash ^ (hash >> 32)), size);
+}
+
+static inline uint32_t hash_fn_multiply_shift(long key, uint32_t size) {
+    uint64_t hash = (uint64_t)key * 0x9E3779B97F4A7C15ULL;
+    return hash_reduce((uint32_t)(hash >> 32), size);
+}
+
+static inline uint32_t hash_fn_murmur(long key, uint32_t size) {
+    uint64_t hash = (uint64_t)key;
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash_reduce((uint32_t)hash, size);
+}
+
+static inline uint32_t hash_fn_crc32c(long key, uint32_t size) {
+#if defined(__SSE4_2__)
+    uint32_t hash = (uint32_t)_mm_crc32_u64(0xFFFFFFFFu, (uint64_t)key);
+#else
+    // 비트 단위 CRC32C (Castagnoli, 반사 다항식 0x82F63B78)
+    uint64_t value = (uint64_t)key;
+    uint32_t hash = 0xFFFFFFFFu;
+    for (int i = 0; i < 64; i++) {
+        uint32_t bit = (hash ^ (uint32_t)value) & 1;
+        hash = (hash >> 1) ^ (0x82F63B78u & -bit);
+        value >>= 1;
+    }
+#endif
+    return hash_reduce(hash, size);
+}
+
+#if HASH_FUNCTION == HASH_FN_MODULO
+#define hash_bucket hash_fn_modulo
+#define HASH_FUNCTION_NAME "modulo-prime"
+#elif HASH_FUNCTION == HASH_FN_FNV1A
+#define hash_bucket hash_fn_fnv1a
+#define HASH_FUNCTION_NAME "fnv-1a"
+#elif HASH_FUNCTION == HASH_FN_MULTIPLY_SHIFT
+#define hash_bucket hash_fn_multiply_shift
+#define HASH_FUNCTION_NAME "multiply-shift"
+#elif HASH_FUNCTION == HASH_FN_MURMUR
+#define hash_bucket hash_fn_murmur
+#define HASH_FUNCTION_NAME "murmur-fmix64"
+#elif HASH_FUNCTION == HASH_FN_CRC32C
+#define hash_bucket hash_fn_crc32c
+#define HASH_FUNCTION_NAME "crc32c"
+#else
+#error "알 수 없는 HASH_FUNCTION"
+#endif
+
+#endif
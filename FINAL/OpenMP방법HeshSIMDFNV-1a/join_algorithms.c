@@ -1,10 +1,10 @@
 #include <stdio.h>
 #include <stdlib.h>
-#include <stdint.h>  // uint32_t, uint64_t 추가
 #include <omp.h>  // OpenMP 헤더 추가
 #include "join_algorithms.h"
 #include "disk_reader.h"
 #include "disk_save.h"
+#include "hash_functions.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -14,15 +14,9 @@
 #include "disk_save.h"
 
 // ========================================
-// FNV-1a 해시 함수 (개선된 해시 분포를 위한)
+// OpenMP 기반 병렬 블록 해시 조인 (결과 저장)
+// - 해시 함수는 hash_functions.h의 HASH_FUNCTION으로 컴파일 시 선택 (기본값 FNV-1a)
 // ========================================
-static inline uint32_t hash_fnv1a(uint64_t key) {
-    const uint64_t prime = 1099511628211ULL;
-    uint64_t hash = 14695981039346656037ULL;
-    hash ^= key;
-    hash *= prime;
-    return (uint32_t)(hash % HASH_SIZE);
-}
 
 long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, const char *order_file,
                                                      int buffer_blocks, const char *output_file, int num_threads) {
@@ -53,6 +47,7 @@ long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, c
 
     printf("총 Customer 레코드: %ld개\n", total_lines);
     printf("%d개 스레드로 병렬 처리 시작 (결과 저장 모드)...\n", num_threads);
+    printf("해시 함수: %s\n", HASH_FUNCTION_NAME);
     printf("출력 파일: %s\n\n", output_file);
 
     // 각 스레드의 작업 범위 계산 (균등 분배)
@@ -180,7 +175,7 @@ long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, c
             // 읽은 Customer 블록을 해시 테이블에 삽입하여 빠른 탐색 준비
             for (int j = 0; j < cust_count; j++) {
                 long key = cust_buffer[j].custkey;
-                int hash = hash_fnv1a(key);  // FNV-1a 해시 사용
+                int hash = hash_bucket(key, HASH_SIZE);
 
                 HashNode *node = (HashNode *)malloc(sizeof(HashNode));
                 node->custkey = key;
@@ -220,7 +215,7 @@ long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, c
                 // 각 Order 레코드에 대해 해시 테이블에서 Customer 매칭 탐색
                 for (int j = 0; j < order_count; j++) {
                     long key = order_buffer[j].custkey;
-                    int hash = hash_fnv1a(key);  // FNV-1a 해시 사용
+                    int hash = hash_bucket(key, HASH_SIZE);
 
                     HashNode *node = hash_table[hash];
                     while (node) {
@@ -218,26 +218,46 @@ long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, c
                 // ========================================
                 // 3.5.4 해시 테이블 탐색 및 결과 매칭/저장
                 // ========================================
-                // 각 Order 레코드에 대해 해시 테이블에서 Customer 매칭 탐색
-                for (int j = 0; j < order_count; j++) {
-                    // 다음 Order 데이터를 미리 캐시에 로드 (프리페칭)
-                    if (j + 8 < order_count) {
-                        __builtin_prefetch(&order_buffer[j + 8], 0, 3);
+                // 그룹 프리페칭: Order 버퍼의 순차 접근은 하드웨어 프리페처가 처리하므로
+                // 실제 캐시 미스가 나는 버킷(hash_table[hash])과 체인 노드를 미리 요청
+                // 1) 그룹 전체의 해시 계산 + 버킷 프리페치
+                // 2) 버킷 헤드 로드 + 첫 노드 프리페치
+                // 3) 체인 탐색 (다음 노드 프리페치), Order 순서대로 결과 추가
+                int hashes[PROBE_GROUP_SIZE];
+                HashNode *heads[PROBE_GROUP_SIZE];
+
+                for (int g = 0; g < order_count; g += PROBE_GROUP_SIZE) {
+                    int group_size = order_count - g;
+                    if (group_size > PROBE_GROUP_SIZE) group_size = PROBE_GROUP_SIZE;
+
+                    for (int k = 0; k < group_size; k++) {
+                        hashes[k] = order_buffer[g + k].custkey % HASH_SIZE;
+                        __builtin_prefetch(&hash_table[hashes[k]], 0, 1);
                     }
 
-                    long key = order_buffer[j].custkey;
-                    int hash = key % HASH_SIZE;
-
-                    HashNode *node = hash_table[hash];
-                    while (node) {
-                        if (node->custkey == key) {
-                            // 매칭 성공: Customer와 Order 정보를 결과 버퍼에 추가
-                            result_buffer_add(result_buf,
-                                            &cust_buffer[node->customer_idx],
-                                            &order_buffer[j]);
-                            result_count++;
+                    for (int k = 0; k < group_size; k++) {
+                        heads[k] = hash_table[hashes[k]];
+                        if (heads[k]) {
+                            __builtin_prefetch(heads[k], 0, 1);
+                        }
+                    }
+
+                    for (int k = 0; k < group_size; k++) {
+                        long key = order_buffer[g + k].custkey;
+                        HashNode *node = heads[k];
+                        while (node) {
+                            if (node->next) {
+                                __builtin_prefetch(node->next, 0, 1);
+                            }
+                            if (node->custkey == key) {
+                                // 매칭 성공: Customer와 Order 정보를 결과 버퍼에 추가
+                                result_buffer_add(result_buf,
+                                                &cust_buffer[node->customer_idx],
+                                                &order_buffer[g + k]);
+                                result_count++;
+                            }
+                            node = node->next;
                         }
-                        node = node->next;
                     }
                 }
             }
@@ -11,6 +11,12 @@ typedef struct HashNode {
 
 #define HASH_SIZE 100003
 
+// 탐색 단계에서 한 번에 해시를 계산하고 버킷을 프리페치하는 Order 수
+// (make PROBE_GROUP_SIZE=N 으로 변경, 1이면 그룹 없이 하나씩 탐색)
+#ifndef PROBE_GROUP_SIZE
+#define PROBE_GROUP_SIZE 16
+#endif
+
 typedef struct {
     const char *customer_file;
     const char *order_file;
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <pthread.h>
 #include "join_algorithms.h"
 #include "disk_reader.h"
@@ -704,3 +705,320 @@ long disk_hash_join(const char *customer_file, const char *order_file) {
     
     return result_count;
 }
+
+// ========================================
+// 병렬 정렬 병합 조인 (Sort-Merge Join)
+// 1. 두 테이블을 (custkey, 행 번호) 쌍으로 읽기
+// 2. 스레드별 히스토그램 + 분산으로 8비트씩 LSD 기수 정렬
+// 3. 키 구간별로 나눠 스레드마다 병합
+// ========================================
+
+typedef struct {
+    const KeyRowPair *src;
+    KeyRowPair *dst;
+    long start;
+    long end;
+    long min_key;
+    int shift;
+    int scatter;                        // 0: 히스토그램, 1: 분산
+    long histogram[RADIX_SORT_BUCKETS];
+    long offsets[RADIX_SORT_BUCKETS];
+} RadixSortArg;
+
+typedef struct {
+    const KeyRowPair *cust;
+    long cust_start;
+    long cust_end;
+    const KeyRowPair *ord;
+    long ord_start;
+    long ord_end;
+    long result_count;
+    int thread_id;
+} MergeArg;
+
+static inline unsigned radix_sort_digit(long key, long min_key, int shift) {
+    return (unsigned)((((unsigned long)key - (unsigned long)min_key) >> shift) & (RADIX_SORT_BUCKETS - 1));
+}
+
+// 파일 전체를 (custkey, 행 번호) 배열로 읽기 (실패 시 -1)
+static long load_key_row_pairs(const char *filename, const char *type, KeyRowPair **out) {
+    DiskReader *reader = disk_reader_open(filename, type);
+    if (!reader) return -1;
+
+    long capacity = 1 << 16;
+    long count = 0;
+    KeyRowPair *pairs = (KeyRowPair *)malloc(sizeof(KeyRowPair) * capacity);
+    if (!pairs) {
+        fprintf(stderr, "키 배열 할당 실패\n");
+        disk_reader_close(reader);
+        return -1;
+    }
+
+    int is_customer = (type[0] == 'c');
+    CustomerRecord cust;
+    OrderRecord ord;
+    while (1) {
+        long key;
+        if (is_customer) {
+            if (!disk_reader_read_customer(reader, &cust)) break;
+            key = cust.custkey;
+        } else {
+            if (!disk_reader_read_order(reader, &ord)) break;
+            key = ord.custkey;
+        }
+
+        if (count == capacity) {
+            capacity *= 2;
+            KeyRowPair *grown = (KeyRowPair *)realloc(pairs, sizeof(KeyRowPair) * capacity);
+            if (!grown) {
+                fprintf(stderr, "키 배열 확장 실패\n");
+                free(pairs);
+                disk_reader_close(reader);
+                return -1;
+            }
+            pairs = grown;
+        }
+        pairs[count].key = key;
+        pairs[count].row = count;
+        count++;
+    }
+
+    disk_reader_close(reader);
+    *out = pairs;
+    return count;
+}
+
+void* radix_sort_worker(void* arg) {
+    RadixSortArg *sort_arg = (RadixSortArg*)arg;
+
+    if (!sort_arg->scatter) {
+        for (int b = 0; b < RADIX_SORT_BUCKETS; b++) {
+            sort_arg->histogram[b] = 0;
+        }
+        for (long i = sort_arg->start; i < sort_arg->end; i++) {
+            sort_arg->histogram[radix_sort_digit(sort_arg->src[i].key, sort_arg->min_key, sort_arg->shift)]++;
+        }
+    } else {
+        // 입력 순서대로 분산하므로 이전 자리의 정렬 순서가 유지됨 (안정 정렬)
+        for (long i = sort_arg->start; i < sort_arg->end; i++) {
+            unsigned digit = radix_sort_digit(sort_arg->src[i].key, sort_arg->min_key, sort_arg->shift);
+            sort_arg->dst[sort_arg->offsets[digit]++] = sort_arg->src[i];
+        }
+    }
+    return NULL;
+}
+
+static int run_radix_sort_phase(RadixSortArg *args) {
+    pthread_t threads[NUM_THREADS];
+
+    for (int t = 0; t < NUM_THREADS; t++) {
+        if (pthread_create(&threads[t], NULL, radix_sort_worker, &args[t]) != 0) {
+            fprintf(stderr, "정렬 스레드 %d 생성 실패\n", t + 1);
+            for (int j = 0; j < t; j++) {
+                pthread_join(threads[j], NULL);
+            }
+            return -1;
+        }
+    }
+    for (int t = 0; t < NUM_THREADS; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    return 0;
+}
+
+// (key, row) 배열을 키 기준으로 정렬 (성공 0, 실패 -1)
+// 키 범위(max - min)에 필요한 바이트 수만큼만 패스를 수행
+static int parallel_radix_sort(KeyRowPair *pairs, long count) {
+    if (count < 2) return 0;
+
+    long min_key = pairs[0].key;
+    long max_key = pairs[0].key;
+    for (long i = 1; i < count; i++) {
+        if (pairs[i].key < min_key) min_key = pairs[i].key;
+        if (pairs[i].key > max_key) max_key = pairs[i].key;
+    }
+
+    unsigned long range = (unsigned long)max_key - (unsigned long)min_key;
+    int passes = 0;
+    while (range > 0) {
+        passes++;
+        range >>= RADIX_SORT_BITS;
+    }
+    if (passes == 0) return 0;
+
+    KeyRowPair *temp = (KeyRowPair *)malloc(sizeof(KeyRowPair) * count);
+    if (!temp) {
+        fprintf(stderr, "정렬 버퍼 할당 실패\n");
+        return -1;
+    }
+
+    RadixSortArg args[NUM_THREADS];
+    long chunk_size = count / NUM_THREADS;
+    KeyRowPair *src = pairs;
+    KeyRowPair *dst = temp;
+
+    for (int pass = 0; pass < passes; pass++) {
+        for (int t = 0; t < NUM_THREADS; t++) {
+            args[t].src = src;
+            args[t].dst = dst;
+            args[t].start = t * chunk_size;
+            args[t].end = (t == NUM_THREADS - 1) ? count : (t + 1) * chunk_size;
+            args[t].min_key = min_key;
+            args[t].shift = pass * RADIX_SORT_BITS;
+            args[t].scatter = 0;
+        }
+        if (run_radix_sort_phase(args) != 0) {
+            free(temp);
+            return -1;
+        }
+
+        // 버킷 순서 → 스레드 순서로 쓰기 위치 계산
+        long offset = 0;
+        for (int b = 0; b < RADIX_SORT_BUCKETS; b++) {
+            for (int t = 0; t < NUM_THREADS; t++) {
+                args[t].offsets[b] = offset;
+                offset += args[t].histogram[b];
+            }
+        }
+
+        for (int t = 0; t < NUM_THREADS; t++) {
+            args[t].scatter = 1;
+        }
+        if (run_radix_sort_phase(args) != 0) {
+            free(temp);
+            return -1;
+        }
+
+        KeyRowPair *swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != pairs) {
+        memcpy(pairs, src, sizeof(KeyRowPair) * count);
+    }
+    free(temp);
+    return 0;
+}
+
+// key 이상인 첫 위치
+static long lower_bound_key(const KeyRowPair *pairs, long count, long key) {
+    long lo = 0;
+    long hi = count;
+    while (lo < hi) {
+        long mid = lo + (hi - lo) / 2;
+        if (pairs[mid].key < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+void* merge_join_worker(void* arg) {
+    MergeArg *merge_arg = (MergeArg*)arg;
+    const KeyRowPair *cust = merge_arg->cust;
+    const KeyRowPair *ord = merge_arg->ord;
+    long i = merge_arg->cust_start;
+    long j = merge_arg->ord_start;
+    long result_count = 0;
+
+    while (i < merge_arg->cust_end && j < merge_arg->ord_end) {
+        if (cust[i].key < ord[j].key) {
+            i++;
+        } else if (cust[i].key > ord[j].key) {
+            j++;
+        } else {
+            // 같은 키 구간끼리 곱집합
+            long key = cust[i].key;
+            long cust_run = i;
+            long ord_run = j;
+            while (i < merge_arg->cust_end && cust[i].key == key) i++;
+            while (j < merge_arg->ord_end && ord[j].key == key) j++;
+            result_count += (i - cust_run) * (j - ord_run);
+        }
+    }
+
+    printf("[Thread %d] 병합 완료: %ld건 매칭\n", merge_arg->thread_id, result_count);
+    merge_arg->result_count = result_count;
+    return NULL;
+}
+
+long disk_parallel_sort_merge_join(const char *customer_file, const char *order_file) {
+    KeyRowPair *cust_pairs = NULL;
+    KeyRowPair *order_pairs = NULL;
+
+    printf("  Load Phase: (custkey, 행 번호) 쌍 읽는 중...\n");
+    long cust_count = load_key_row_pairs(customer_file, "customer", &cust_pairs);
+    if (cust_count < 0) return -1;
+    long order_count = load_key_row_pairs(order_file, "order", &order_pairs);
+    if (order_count < 0) {
+        free(cust_pairs);
+        return -1;
+    }
+    printf("    Customer %ld개, Order %ld개\n", cust_count, order_count);
+
+    printf("  Sort Phase: %d개 스레드로 LSD 기수 정렬 (%d비트씩)...\n", NUM_THREADS, RADIX_SORT_BITS);
+    if (parallel_radix_sort(cust_pairs, cust_count) != 0 ||
+        parallel_radix_sort(order_pairs, order_count) != 0) {
+        free(cust_pairs);
+        free(order_pairs);
+        return -1;
+    }
+
+    // 키 구간 분할: 큰 쪽(Orders)의 분위수 키를 경계로 삼아
+    // 같은 키가 두 스레드에 걸치지 않도록 lower_bound로 맞춤
+    printf("  Merge Phase: 키 구간별 병렬 병합...\n");
+    long cust_bounds[NUM_THREADS + 1];
+    long order_bounds[NUM_THREADS + 1];
+    cust_bounds[0] = 0;
+    order_bounds[0] = 0;
+    cust_bounds[NUM_THREADS] = cust_count;
+    order_bounds[NUM_THREADS] = order_count;
+    for (int t = 1; t < NUM_THREADS; t++) {
+        long split = order_count * t / NUM_THREADS;
+        if (split < order_count) {
+            long key = order_pairs[split].key;
+            order_bounds[t] = lower_bound_key(order_pairs, order_count, key);
+            cust_bounds[t] = lower_bound_key(cust_pairs, cust_count, key);
+        } else {
+            order_bounds[t] = order_count;
+            cust_bounds[t] = cust_count;
+        }
+        if (order_bounds[t] < order_bounds[t - 1]) order_bounds[t] = order_bounds[t - 1];
+        if (cust_bounds[t] < cust_bounds[t - 1]) cust_bounds[t] = cust_bounds[t - 1];
+    }
+
+    pthread_t threads[NUM_THREADS];
+    MergeArg merge_args[NUM_THREADS];
+    int created = 0;
+    for (int t = 0; t < NUM_THREADS; t++) {
+        merge_args[t].cust = cust_pairs;
+        merge_args[t].cust_start = cust_bounds[t];
+        merge_args[t].cust_end = cust_bounds[t + 1];
+        merge_args[t].ord = order_pairs;
+        merge_args[t].ord_start = order_bounds[t];
+        merge_args[t].ord_end = order_bounds[t + 1];
+        merge_args[t].result_count = 0;
+        merge_args[t].thread_id = t + 1;
+
+        if (pthread_create(&threads[t], NULL, merge_join_worker, &merge_args[t]) != 0) {
+            fprintf(stderr, "Thread %d 생성 실패\n", t + 1);
+            break;
+        }
+        created++;
+    }
+
+    long total_result = 0;
+    for (int t = 0; t < created; t++) {
+        pthread_join(threads[t], NULL);
+        total_result += merge_args[t].result_count;
+    }
+
+    free(cust_pairs);
+    free(order_pairs);
+
+    if (created < NUM_THREADS) return -1;
+    return total_result;
+}
@@ -12,6 +12,15 @@ typedef struct HashNode {
 #define HASH_SIZE 100003
 #define NUM_THREADS 4
 
+// 정렬 병합 조인용 (키, 행 번호) 쌍
+typedef struct {
+    long key;
+    long row;
+} KeyRowPair;
+
+#define RADIX_SORT_BITS 8
+#define RADIX_SORT_BUCKETS (1 << RADIX_SORT_BITS)
+
 typedef struct {
     const char *customer_file;
     const char *order_file;
@@ -28,5 +37,6 @@ long disk_block_nested_loop_join_hash(const char *customer_file, const char *ord
 long disk_parallel_block_nested_loop_join(const char *customer_file, const char *order_file, int buffer_blocks);
 long disk_parallel_block_nested_loop_join_hash(const char *customer_file, const char *order_file, int buffer_blocks);
 long disk_hash_join(const char *customer_file, const char *order_file);
+long disk_parallel_sort_merge_join(const char *customer_file, const char *order_file);
 
 #endif
@@ -101,6 +101,21 @@ void run_disk_parallel_block_nested_loop_join_hash_test(const char *customer_fil
     printf("    디스크 I/O 횟수: %ld회\n\n", io_count);
 }
 
+void run_disk_parallel_sort_merge_join_test(const char *customer_file, const char *order_file) {
+    printf("[테스트 7: 병렬 정렬 병합 조인 (Parallel Sort-Merge Join, LSD 기수 정렬, 4 스레드)]\n");
+    
+    disk_reader_reset_io_count();
+    double start = get_time_sec();
+    long result = disk_parallel_sort_merge_join(customer_file, order_file);
+    double end = get_time_sec();
+    long io_count = disk_reader_get_io_count();
+    
+    printf("  결과:\n");
+    printf("    매칭된 레코드: %ld개\n", result);
+    printf("    실행 시간: %.3f초\n", end - start);
+    printf("    디스크 I/O 횟수: %ld회\n\n", io_count);
+}
+
 int main() {
     const char *customer_file = "../tbl/customer.tbl";
     const char *order_file = "../tbl/orders.tbl";
@@ -117,5 +132,9 @@ int main() {
     run_disk_parallel_block_nested_loop_join_hash_test(customer_file, order_file, 100);
     run_disk_parallel_block_nested_loop_join_hash_test(customer_file, order_file, 50);
 
+    printf("\n=== 해시 조인 vs 정렬 병합 조인 ===\n\n");
+    run_disk_hash_join_test(customer_file, order_file);
+    run_disk_parallel_sort_merge_join_test(customer_file, order_file);
+
     return 0;
 }
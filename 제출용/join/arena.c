@@ -0,0 +1,58 @@
+#define _POSIX_C_SOURCE 200112L  // posix_memalign
+#include <stdio.h>
+#include <stdlib.h>
+#include "arena.h"
+
+// ========================================
+// 아레나 할당기 모듈 (Arena Module)
+// - 큰 영역 하나를 미리 할당하고 앞에서부터 잘라 씀
+// - 개별 해제 없음: 블록 처리가 끝나면 arena_reset으로 사용량만 0으로 되돌림
+// ========================================
+
+Arena* arena_create(size_t capacity) {
+    Arena *arena = (Arena *)malloc(sizeof(Arena));
+    if (!arena) {
+        return NULL;
+    }
+
+    capacity = arena_size_for(capacity);
+    void *base = NULL;
+    if (posix_memalign(&base, ARENA_ALIGN, capacity ? capacity : ARENA_ALIGN) != 0) {
+        fprintf(stderr, "아레나 할당 실패 (%zu 바이트)\n", capacity);
+        free(arena);
+        return NULL;
+    }
+
+    arena->base = (char *)base;
+    arena->capacity = capacity;
+    arena->used = 0;
+    arena->peak = 0;
+    return arena;
+}
+
+void arena_destroy(Arena *arena) {
+    if (arena) {
+        free(arena->base);
+        free(arena);
+    }
+}
+
+void* arena_alloc(Arena *arena, size_t size) {
+    size = arena_size_for(size);
+    if (size > arena->capacity - arena->used) {
+        fprintf(stderr, "아레나 공간 부족 (요청 %zu, 남은 공간 %zu 바이트)\n",
+                size, arena->capacity - arena->used);
+        return NULL;
+    }
+
+    void *ptr = arena->base + arena->used;
+    arena->used += size;
+    if (arena->used > arena->peak) {
+        arena->peak = arena->used;
+    }
+    return ptr;
+}
+
+void arena_reset(Arena *arena) {
+    arena->used = 0;
+}
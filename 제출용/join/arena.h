@@ -0,0 +1,37 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+// ========================================
+// 아레나 할당기 (Bump Allocator)
+// - Customer 블록 하나 동안만 쓰는 구조체(해시 슬롯, 키 배열 등)를 위한 스레드 전용 메모리
+// - 할당은 포인터 증가, 블록 사이 해제는 arena_reset 한 번 (O(1))
+// - 스레드마다 따로 만들어 쓰므로 잠금 없음 (glibc malloc 경합 제거)
+// ========================================
+
+#define ARENA_ALIGN 64  // 캐시 라인 정렬
+
+typedef struct {
+    char *base;
+    size_t capacity;        // 전체 크기 (바이트)
+    size_t used;            // 현재 사용량
+    size_t peak;            // 최대 사용량 (크기 조정 참고용)
+} Arena;
+
+// capacity 바이트 아레나 생성 (실패 시 NULL)
+Arena* arena_create(size_t capacity);
+void arena_destroy(Arena *arena);
+
+// size 바이트를 ARENA_ALIGN 정렬로 할당 (공간 부족 시 NULL, 초기화하지 않음)
+void* arena_alloc(Arena *arena, size_t size);
+
+// 모든 할당을 한 번에 해제 (메모리는 유지)
+void arena_reset(Arena *arena);
+
+// size 바이트 할당에 필요한 최대 아레나 공간 (정렬 여유 포함)
+static inline size_t arena_size_for(size_t size) {
+    return (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+#endif
@@ -1,21 +1,25 @@
 #!/bin/bash
 
-# 블록 사이즈 벤치마크 스크립트
-# 50MB부터 7000MB까지 블록 사이즈로 테스트
+# 메모리 예산 벤치마크 스크립트
+# 메모리 예산(MB)별로 테스트 (I/O 블록 크기는 예산 / (4 × 스레드 수)로 유도됨)
 # 각 사이즈당 7번 실행하여 표준편차 기반 이상치 제거 후 평균 계산
 
-echo "블록 사이즈 벤치마크 시작"
+echo "메모리 예산 벤치마크 시작"
 echo "========================================"
 
-# 블록 사이즈 리스트 (MB)
-block_sizes_mb=(193 197)
+# 메모리 예산 리스트 (MB) - 8스레드 기준 이전 블록 크기 193/197MB와 같은 I/O 블록
+budgets_mb=(6176 6304)
+
+# 입력 방식 (mmap, fread, columnar, direct) - 예: IO_MODE=direct ./benchmark.sh
+io_mode=${IO_MODE:-mmap}
+echo "입력 방식: ${io_mode}"
 
 # 결과 파일
 output_file="benchmark_results.csv"
-echo "BlockSize_MB,AvgTime_sec,StdDev,ValidSamples" > "$output_file"
+echo "Budget_MB,AvgTime_sec,StdDev,ValidSamples" > "$output_file"
 
-for size_mb in "${block_sizes_mb[@]}"; do
-    echo "블록 사이즈: ${size_mb}MB 테스트 중..."
+for size_mb in "${budgets_mb[@]}"; do
+    echo "메모리 예산: ${size_mb}MB 테스트 중..."
     
     # 7번 실행하여 시간 측정
     times=()
@@ -24,7 +28,7 @@ for size_mb in "${block_sizes_mb[@]}"; do
         
         # 실행 시간 측정 (실제 시간만)
         start_time=$(date +%s.%N)
-        ./run.out 8 $size_mb > /dev/null 2>&1
+        ./run.out 8 $size_mb $io_mode > /dev/null 2>&1
         exit_code=$?
         end_time=$(date +%s.%N)
         
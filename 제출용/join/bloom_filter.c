@@ -0,0 +1,55 @@
+#include <stdio.h>
+#include <string.h>
+#include "bloom_filter.h"
+
+// ========================================
+// 블룸 필터 모듈 (Bloom Filter Module)
+// - 워드 수는 expected × BLOOM_FILTER_BITS_PER_KEY / 64 이상인 2의 거듭제곱
+// - 삭제가 없으므로 블록이 바뀔 때 아레나와 함께 버리고 새로 만듦
+// ========================================
+
+static BloomFilterMode default_mode = BLOOM_FILTER_AUTO;
+
+void bloom_filter_set_mode(BloomFilterMode mode) {
+    default_mode = mode;
+}
+
+BloomFilterMode bloom_filter_get_mode(void) {
+    return default_mode;
+}
+
+const char* bloom_filter_mode_name(BloomFilterMode mode) {
+    switch (mode) {
+        case BLOOM_FILTER_ON:  return "on";
+        case BLOOM_FILTER_OFF: return "off";
+        default:               return "auto";
+    }
+}
+
+static size_t words_for(size_t expected) {
+    size_t need = (expected * BLOOM_FILTER_BITS_PER_KEY + 63) / 64;
+    size_t words = 1;
+    while (words < need) {
+        words <<= 1;
+    }
+    return words;
+}
+
+size_t bloom_filter_arena_bytes(size_t expected) {
+    return arena_size_for(sizeof(BloomFilter)) +
+           arena_size_for(sizeof(uint64_t) * words_for(expected));
+}
+
+BloomFilter* bloom_filter_create(Arena *arena, size_t expected) {
+    size_t words = words_for(expected);
+    BloomFilter *filter = (BloomFilter *)arena_alloc(arena, sizeof(BloomFilter));
+    uint64_t *bits = (uint64_t *)arena_alloc(arena, sizeof(uint64_t) * words);
+    if (!filter || !bits) {
+        fprintf(stderr, "블룸 필터 할당 실패 (워드 %zu개)\n", words);
+        return NULL;
+    }
+    memset(bits, 0, sizeof(uint64_t) * words);
+    filter->words = bits;
+    filter->mask = words - 1;
+    return filter;
+}
@@ -0,0 +1,68 @@
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "arena.h"
+
+// ========================================
+// 레지스터 블록 블룸 필터 (Register-blocked Bloom Filter)
+// - 키 하나의 비트 BLOOM_FILTER_HASHES개를 모두 64비트 워드 하나에 설정
+//   → 검사는 워드 1개 읽기 + AND/비교 1번 (캐시 미스 최대 1회)
+// - 블록 조인에서 Customer 블록과 함께 만들고, Order 키를 테이블 탐색 전에 걸러냄
+//   (Order 재스캔에서 현재 블록과 맞는 행은 약 1/블록 수이므로 대부분이 여기서 탈락)
+// - 키당 BLOOM_FILTER_BITS_PER_KEY비트: 블록 하나 분량이 L2 캐시에 들어가는 크기
+// ========================================
+
+#define BLOOM_FILTER_BITS_PER_KEY 8
+#define BLOOM_FILTER_HASHES 4      // 키당 설정 비트 수 (각 6비트로 워드 내 위치 선택)
+
+typedef enum {
+    BLOOM_FILTER_AUTO = 0,         // 해시 테이블 블록에서만 사용 (직접 주소 테이블은 범위 검사로 충분)
+    BLOOM_FILTER_ON = 1,           // 모든 블록에서 사용
+    BLOOM_FILTER_OFF = 2
+} BloomFilterMode;
+
+typedef struct {
+    uint64_t *words;
+    size_t mask;                   // 워드 수 - 1 (워드 수는 2의 거듭제곱)
+} BloomFilter;
+
+// 사용 방식 설정/조회 (블록 조인에 적용)
+void bloom_filter_set_mode(BloomFilterMode mode);
+BloomFilterMode bloom_filter_get_mode(void);
+const char* bloom_filter_mode_name(BloomFilterMode mode);
+
+// expected개용 빈 필터를 아레나에 생성 (공간 부족 시 NULL)
+BloomFilter* bloom_filter_create(Arena *arena, size_t expected);
+
+// expected개용 필터가 차지하는 최대 아레나 공간 (아레나 크기 산정용)
+size_t bloom_filter_arena_bytes(size_t expected);
+
+// 키의 워드 위치(상위 비트)와 워드 내 비트 마스크(하위 비트)
+static inline uint64_t bloom_filter_hash(long key) {
+    uint64_t h = (uint64_t)key * 0xC2B2AE3D27D4EB4FULL;
+    return h ^ (h >> 29);
+}
+
+static inline uint64_t bloom_filter_bits(uint64_t h) {
+    uint64_t bits = 0;
+    for (int i = 0; i < BLOOM_FILTER_HASHES; i++) {
+        bits |= 1ULL << ((h >> (6 * i)) & 63);
+    }
+    return bits;
+}
+
+static inline void bloom_filter_add(BloomFilter *filter, long key) {
+    uint64_t h = bloom_filter_hash(key);
+    filter->words[(h >> 32) & filter->mask] |= bloom_filter_bits(h);
+}
+
+// 0이면 확실히 없음, 1이면 있을 수 있음
+static inline int bloom_filter_may_contain(const BloomFilter *filter, long key) {
+    uint64_t h = bloom_filter_hash(key);
+    uint64_t bits = bloom_filter_bits(h);
+    return (filter->words[(h >> 32) & filter->mask] & bits) == bits;
+}
+
+#endif
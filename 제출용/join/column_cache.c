@@ -0,0 +1,391 @@
+#define _GNU_SOURCE  // st_mtim, madvise
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "column_cache.h"
+
+// ========================================
+// 컬럼 캐시 모듈 (Column Cache Module)
+// - 첫 실행 시 .tbl 텍스트를 한 번 파싱하여 컬럼별 바이너리 파일로 저장
+// - 이후 실행은 파싱 없이 필요한 컬럼 파일만 mmap하여 스캔
+// - 파일 구성: <원본>.colmeta, <원본>.col<N> (+ 문자열은 <원본>.col<N>.off)
+// ========================================
+
+#define COLUMN_CACHE_MAGIC 0x434C4254u  // "TBLC"
+#define COLUMN_CACHE_VERSION 1
+#define COLUMN_CACHE_BUILD_BLOCK (64 * 1024 * 1024)
+#define COLUMN_CACHE_BUILD_BATCH 4096
+
+typedef enum {
+    COLUMN_INT64,   // long / Decimal (8바이트)
+    COLUMN_CHAR,    // 단일 문자
+    COLUMN_STRING   // 가변 길이 문자열 (오프셋 + 힙)
+} ColumnType;
+
+// 컬럼 정의: 레코드 구조체 필드와 캐시 파일을 연결
+typedef struct {
+    unsigned mask;      // CUST_COL_* / ORDER_COL_*
+    ColumnType type;
+    size_t offset;      // 레코드 구조체 내 위치
+    int max_len;        // 문자열 최대 길이 (NUL 제외)
+} ColumnDef;
+
+// 메타데이터 파일 형식 (원본 크기/수정 시각으로 유효성 판단)
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t table;
+    uint32_t num_columns;
+    int64_t source_size;
+    int64_t source_mtime_sec;
+    int64_t source_mtime_nsec;
+    int64_t rows;
+} ColumnCacheMeta;
+
+static const ColumnDef customer_columns[] = {
+    {CUST_COL_CUSTKEY,    COLUMN_INT64,  offsetof(CustomerRecord, custkey),    0},
+    {CUST_COL_NAME,       COLUMN_STRING, offsetof(CustomerRecord, name),       25},
+    {CUST_COL_ADDRESS,    COLUMN_STRING, offsetof(CustomerRecord, address),    40},
+    {CUST_COL_NATIONKEY,  COLUMN_INT64,  offsetof(CustomerRecord, nationkey),  0},
+    {CUST_COL_PHONE,      COLUMN_STRING, offsetof(CustomerRecord, phone),      15},
+    {CUST_COL_ACCTBAL,    COLUMN_INT64,  offsetof(CustomerRecord, acctbal),    0},
+    {CUST_COL_MKTSEGMENT, COLUMN_STRING, offsetof(CustomerRecord, mktsegment), 10},
+    {CUST_COL_COMMENT,    COLUMN_STRING, offsetof(CustomerRecord, comment),    117},
+};
+
+static const ColumnDef order_columns[] = {
+    {ORDER_COL_ORDERKEY,      COLUMN_INT64,  offsetof(OrderRecord, orderkey),      0},
+    {ORDER_COL_CUSTKEY,       COLUMN_INT64,  offsetof(OrderRecord, custkey),       0},
+    {ORDER_COL_ORDERSTATUS,   COLUMN_CHAR,   offsetof(OrderRecord, orderstatus),   0},
+    {ORDER_COL_TOTALPRICE,    COLUMN_INT64,  offsetof(OrderRecord, totalprice),    0},
+    {ORDER_COL_ORDERDATE,     COLUMN_STRING, offsetof(OrderRecord, orderdate),     10},
+    {ORDER_COL_ORDERPRIORITY, COLUMN_STRING, offsetof(OrderRecord, orderpriority), 15},
+    {ORDER_COL_CLERK,         COLUMN_STRING, offsetof(OrderRecord, clerk),         15},
+    {ORDER_COL_SHIPPRIORITY,  COLUMN_INT64,  offsetof(OrderRecord, shippriority),  0},
+    {ORDER_COL_COMMENT,       COLUMN_STRING, offsetof(OrderRecord, comment),       79},
+};
+
+static const ColumnDef* table_columns(ColumnTable table, int *count) {
+    if (table == COLUMN_TABLE_CUSTOMER) {
+        *count = sizeof(customer_columns) / sizeof(customer_columns[0]);
+        return customer_columns;
+    }
+    *count = sizeof(order_columns) / sizeof(order_columns[0]);
+    return order_columns;
+}
+
+static size_t column_width(ColumnType type) {
+    return type == COLUMN_INT64 ? 8 : 1;
+}
+
+ColumnTable column_table_from_type(const char *type) {
+    return (type && strcmp(type, "customer") == 0) ? COLUMN_TABLE_CUSTOMER : COLUMN_TABLE_ORDER;
+}
+
+// ========================================
+// 1. 캐시 파일 경로 및 유효성 검사
+// ========================================
+
+static void cache_path(char *out, size_t size, const char *filename, const char *suffix, int column) {
+    if (column < 0) {
+        snprintf(out, size, "%s.%s", filename, suffix);
+    } else {
+        snprintf(out, size, "%s.col%d%s", filename, column, suffix);
+    }
+}
+
+// 메타데이터가 원본 파일과 일치하면 1 반환
+static int cache_is_valid(const char *filename, ColumnTable table, ColumnCacheMeta *meta) {
+    struct stat st;
+    if (stat(filename, &st) != 0) {
+        return 0;
+    }
+
+    char path[1024];
+    cache_path(path, sizeof(path), filename, "colmeta", -1);
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        return 0;
+    }
+    size_t got = fread(meta, sizeof(*meta), 1, fp);
+    fclose(fp);
+
+    int num_columns;
+    table_columns(table, &num_columns);
+    return got == 1 &&
+           meta->magic == COLUMN_CACHE_MAGIC &&
+           meta->version == COLUMN_CACHE_VERSION &&
+           meta->table == (uint32_t)table &&
+           meta->num_columns == (uint32_t)num_columns &&
+           meta->source_size == (int64_t)st.st_size &&
+           meta->source_mtime_sec == (int64_t)st.st_mtim.tv_sec &&
+           meta->source_mtime_nsec == (int64_t)st.st_mtim.tv_nsec;
+}
+
+// ========================================
+// 2. 캐시 생성 (텍스트 파싱 1회 -> 컬럼 파일 기록)
+// ========================================
+
+typedef struct {
+    FILE *data;
+    FILE *offsets;
+    uint64_t heap_size;
+} ColumnWriter;
+
+static void write_row(ColumnWriter *writers, const ColumnDef *defs, int num_columns, const char *record) {
+    for (int c = 0; c < num_columns; c++) {
+        const char *field = record + defs[c].offset;
+        if (defs[c].type == COLUMN_STRING) {
+            size_t len = strnlen(field, defs[c].max_len);
+            fwrite(field, 1, len, writers[c].data);
+            writers[c].heap_size += len;
+            fwrite(&writers[c].heap_size, sizeof(uint64_t), 1, writers[c].offsets);
+        } else {
+            fwrite(field, column_width(defs[c].type), 1, writers[c].data);
+        }
+    }
+}
+
+// 임시 파일에 모든 컬럼을 기록한 뒤 이름 변경, 메타데이터는 마지막에 기록
+static int build_cache(const char *filename, ColumnTable table) {
+    int num_columns;
+    const ColumnDef *defs = table_columns(table, &num_columns);
+    char path[1024], tmp[1024];
+
+    // 기존 메타데이터 제거: 생성 도중 중단되어도 불완전한 캐시를 쓰지 않음
+    cache_path(path, sizeof(path), filename, "colmeta", -1);
+    unlink(path);
+
+    struct stat st;
+    if (stat(filename, &st) != 0) {
+        perror("stat");
+        return -1;
+    }
+
+    const char *type = table == COLUMN_TABLE_CUSTOMER ? "customer" : "order";
+    DiskReader *reader = disk_reader_open_mode(filename, type, COLUMN_CACHE_BUILD_BLOCK, DISK_READER_MODE_MMAP);
+    if (!reader) {
+        return -1;
+    }
+
+    size_t record_size = table == COLUMN_TABLE_CUSTOMER ? sizeof(CustomerRecord) : sizeof(OrderRecord);
+    char *batch = (char *)malloc(record_size * COLUMN_CACHE_BUILD_BATCH);
+    ColumnWriter writers[COLUMN_CACHE_MAX_COLUMNS];
+    memset(writers, 0, sizeof(writers));
+    int ok = batch != NULL;
+
+    // 컬럼별 임시 파일 열기
+    for (int c = 0; ok && c < num_columns; c++) {
+        cache_path(tmp, sizeof(tmp), filename, ".tmp", c);
+        writers[c].data = fopen(tmp, "wb");
+        ok = writers[c].data != NULL;
+        if (ok && defs[c].type == COLUMN_STRING) {
+            cache_path(tmp, sizeof(tmp), filename, ".off.tmp", c);
+            writers[c].offsets = fopen(tmp, "wb");
+            ok = writers[c].offsets != NULL;
+            if (ok) {
+                fwrite(&writers[c].heap_size, sizeof(uint64_t), 1, writers[c].offsets);  // 첫 오프셋 0
+            }
+        }
+    }
+    if (!ok) {
+        perror("컬럼 캐시 파일 생성 실패");
+    }
+
+    // 원본 전체를 일괄 읽기로 파싱하며 행 단위로 기록
+    long rows = 0;
+    int count;
+    while (ok) {
+        int more = table == COLUMN_TABLE_CUSTOMER
+            ? disk_reader_read_customers_batch(reader, (CustomerRecord *)batch, COLUMN_CACHE_BUILD_BATCH, &count)
+            : disk_reader_read_orders_batch(reader, (OrderRecord *)batch, COLUMN_CACHE_BUILD_BATCH, &count);
+        if (!more) {
+            break;
+        }
+        for (int i = 0; i < count; i++) {
+            write_row(writers, defs, num_columns, batch + record_size * i);
+        }
+        rows += count;
+    }
+
+    // 파일 닫기 및 최종 이름으로 교체
+    for (int c = 0; c < num_columns; c++) {
+        if (writers[c].data && fclose(writers[c].data) != 0) ok = 0;
+        if (writers[c].offsets && fclose(writers[c].offsets) != 0) ok = 0;
+        if (ok) {
+            cache_path(tmp, sizeof(tmp), filename, ".tmp", c);
+            cache_path(path, sizeof(path), filename, "", c);
+            if (rename(tmp, path) != 0) ok = 0;
+            if (ok && defs[c].type == COLUMN_STRING) {
+                cache_path(tmp, sizeof(tmp), filename, ".off.tmp", c);
+                cache_path(path, sizeof(path), filename, ".off", c);
+                if (rename(tmp, path) != 0) ok = 0;
+            }
+        }
+    }
+    free(batch);
+    disk_reader_close(reader);
+
+    if (!ok) {
+        fprintf(stderr, "컬럼 캐시 생성 실패: %s\n", filename);
+        return -1;
+    }
+
+    ColumnCacheMeta meta = {
+        .magic = COLUMN_CACHE_MAGIC,
+        .version = COLUMN_CACHE_VERSION,
+        .table = (uint32_t)table,
+        .num_columns = (uint32_t)num_columns,
+        .source_size = (int64_t)st.st_size,
+        .source_mtime_sec = (int64_t)st.st_mtim.tv_sec,
+        .source_mtime_nsec = (int64_t)st.st_mtim.tv_nsec,
+        .rows = rows,
+    };
+    cache_path(tmp, sizeof(tmp), filename, "colmeta.tmp", -1);
+    cache_path(path, sizeof(path), filename, "colmeta", -1);
+    FILE *fp = fopen(tmp, "wb");
+    if (!fp || fwrite(&meta, sizeof(meta), 1, fp) != 1 || fclose(fp) != 0 || rename(tmp, path) != 0) {
+        perror("컬럼 캐시 메타데이터 기록 실패");
+        return -1;
+    }
+
+    return 0;
+}
+
+int column_cache_prepare(const char *filename, ColumnTable table) {
+    ColumnCacheMeta meta;
+    if (cache_is_valid(filename, table, &meta)) {
+        return 0;
+    }
+
+    printf("컬럼 캐시 생성 중: %s\n", filename);
+    return build_cache(filename, table);
+}
+
+// ========================================
+// 3. 캐시 열기 (컬럼 파일 mmap) 및 정리
+// ========================================
+
+static const char* map_column_file(const char *path, size_t *size) {
+    *size = 0;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    struct stat st;
+    const char *addr = NULL;
+    if (fstat(fd, &st) == 0) {
+        if (st.st_size == 0) {
+            addr = "";  // 빈 컬럼 (행 없음 또는 빈 문자열만 존재)
+        } else {
+            void *map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            if (map != MAP_FAILED) {
+                madvise(map, st.st_size, MADV_SEQUENTIAL);
+                addr = (const char *)map;
+                *size = st.st_size;
+            }
+        }
+    }
+    close(fd);
+    return addr;
+}
+
+ColumnCache* column_cache_open(const char *filename, ColumnTable table) {
+    ColumnCacheMeta meta;
+    if (!cache_is_valid(filename, table, &meta)) {
+        return NULL;
+    }
+
+    ColumnCache *cache = (ColumnCache *)calloc(1, sizeof(ColumnCache));
+    if (!cache) {
+        return NULL;
+    }
+    cache->table = table;
+    cache->rows = meta.rows;
+    cache->source_size = meta.source_size;
+
+    const ColumnDef *defs = table_columns(table, &cache->num_columns);
+    char path[1024];
+    for (int c = 0; c < cache->num_columns; c++) {
+        ColumnFile *col = &cache->columns[c];
+        cache_path(path, sizeof(path), filename, "", c);
+        col->data = map_column_file(path, &col->data_size);
+        int ok = col->data != NULL;
+        if (defs[c].type == COLUMN_STRING) {
+            cache_path(path, sizeof(path), filename, ".off", c);
+            col->offsets = (const uint64_t *)map_column_file(path, &col->offsets_size);
+            ok = ok && col->offsets_size == sizeof(uint64_t) * (meta.rows + 1);
+        } else {
+            ok = ok && col->data_size == column_width(defs[c].type) * meta.rows;
+        }
+        if (!ok) {
+            fprintf(stderr, "컬럼 캐시 손상: %s\n", path);
+            column_cache_close(cache);
+            return NULL;
+        }
+    }
+
+    return cache;
+}
+
+void column_cache_close(ColumnCache *cache) {
+    if (!cache) {
+        return;
+    }
+    for (int c = 0; c < cache->num_columns; c++) {
+        ColumnFile *col = &cache->columns[c];
+        if (col->data_size > 0) {
+            munmap((void *)col->data, col->data_size);
+        }
+        if (col->offsets_size > 0) {
+            munmap((void *)col->offsets, col->offsets_size);
+        }
+    }
+    free(cache);
+}
+
+// ========================================
+// 4. 행 복원 (필요한 컬럼만 레코드 구조체로 복사)
+// ========================================
+
+static inline void read_row(const ColumnCache *cache, const ColumnDef *defs, long row,
+                            unsigned cols, char *record) {
+    for (int c = 0; c < cache->num_columns; c++) {
+        if (!(cols & defs[c].mask)) {
+            continue;
+        }
+        const ColumnFile *col = &cache->columns[c];
+        char *field = record + defs[c].offset;
+        switch (defs[c].type) {
+        case COLUMN_INT64:
+            memcpy(field, col->data + row * 8, 8);
+            break;
+        case COLUMN_CHAR:
+            *field = col->data[row];
+            break;
+        case COLUMN_STRING: {
+            uint64_t begin = col->offsets[row];
+            size_t len = col->offsets[row + 1] - begin;
+            if (len > (size_t)defs[c].max_len) {
+                len = defs[c].max_len;
+            }
+            memcpy(field, col->data + begin, len);
+            field[len] = '\0';
+            break;
+        }
+        }
+    }
+}
+
+void column_cache_read_customer(const ColumnCache *cache, long row, unsigned cols, CustomerRecord *record) {
+    read_row(cache, customer_columns, row, cols, (char *)record);
+}
+
+void column_cache_read_order(const ColumnCache *cache, long row, unsigned cols, OrderRecord *record) {
+    read_row(cache, order_columns, row, cols, (char *)record);
+}
@@ -0,0 +1,52 @@
+#ifndef COLUMN_CACHE_H
+#define COLUMN_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "disk_reader.h"
+
+// ========================================
+// .tbl 파일의 바이너리 컬럼 캐시
+// - 컬럼마다 별도 파일: 고정폭 정수는 배열, 문자열은 오프셋 배열 + 힙
+// - 원본 파일의 크기/수정 시각이 메타데이터와 다르면 자동 재생성
+// ========================================
+
+#define COLUMN_CACHE_MAX_COLUMNS 9
+
+typedef enum {
+    COLUMN_TABLE_CUSTOMER = 0,
+    COLUMN_TABLE_ORDER = 1
+} ColumnTable;
+
+// 매핑된 컬럼 파일 하나 (문자열 컬럼은 offsets + data(힙))
+typedef struct {
+    const char *data;          // 고정폭 값 배열 또는 문자열 힙
+    size_t data_size;
+    const uint64_t *offsets;   // 문자열 컬럼: 행별 힙 시작 위치 (rows + 1개)
+    size_t offsets_size;
+} ColumnFile;
+
+typedef struct ColumnCache {
+    ColumnTable table;
+    long rows;
+    long source_size;          // 원본 .tbl 크기 (블록 크기 환산용)
+    int num_columns;
+    ColumnFile columns[COLUMN_CACHE_MAX_COLUMNS];
+} ColumnCache;
+
+// "customer" / "order" 문자열을 테이블 종류로 변환
+ColumnTable column_table_from_type(const char *type);
+
+// 캐시가 없거나 원본이 바뀌었으면 (재)생성 (성공 0, 실패 -1)
+// 여러 스레드가 동시에 호출하지 않도록 병렬 영역 밖에서 한 번 호출
+int column_cache_prepare(const char *filename, ColumnTable table);
+
+// 유효한 캐시를 읽기 전용으로 매핑 (없거나 오래되었으면 NULL)
+ColumnCache* column_cache_open(const char *filename, ColumnTable table);
+void column_cache_close(ColumnCache *cache);
+
+// row번째 행에서 cols 마스크에 해당하는 컬럼만 레코드로 복원
+void column_cache_read_customer(const ColumnCache *cache, long row, unsigned cols, CustomerRecord *record);
+void column_cache_read_order(const ColumnCache *cache, long row, unsigned cols, OrderRecord *record);
+
+#endif
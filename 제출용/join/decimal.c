@@ -0,0 +1,67 @@
+#include "decimal.h"
+
+// ========================================
+// 고정소수점 십진수 모듈 (Decimal Module)
+// - strtod / printf("%.2f") 대체: 로케일 조회와 부동소수점 변환 없음
+// - 값은 센트 단위 정수로 보관하여 집계 시 오차가 없음
+// ========================================
+
+Decimal decimal_parse(const char *p, const char *end) {
+    int negative = 0;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+
+    // 정수부
+    Decimal whole = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        whole = whole * 10 + (*p++ - '0');
+    }
+
+    // 소수부: 두 자리까지 사용, 셋째 자리에서 반올림
+    Decimal frac = 0;
+    if (p < end && *p == '.') {
+        p++;
+        int digits = 0;
+        while (p < end && *p >= '0' && *p <= '9' && digits < 2) {
+            frac = frac * 10 + (*p++ - '0');
+            digits++;
+        }
+        if (digits == 1) {
+            frac *= 10;
+        }
+        if (p < end && *p >= '5' && *p <= '9') {
+            frac++;
+        }
+    }
+
+    Decimal value = whole * DECIMAL_SCALE + frac;
+    return negative ? -value : value;
+}
+
+int decimal_format(Decimal value, char *out) {
+    char digits[DECIMAL_STR_MAX];
+    int len = 0;
+
+    uint64_t magnitude = value < 0 ? (uint64_t)0 - (uint64_t)value : (uint64_t)value;
+
+    // 소수부 두 자리와 정수부를 역순으로 생성 (정수부는 최소 한 자리)
+    do {
+        digits[len++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+        if (len == 2) {
+            digits[len++] = '.';
+        }
+    } while (magnitude > 0 || len < 4);
+
+    int pos = 0;
+    if (value < 0) {
+        out[pos++] = '-';
+    }
+    while (len > 0) {
+        out[pos++] = digits[--len];
+    }
+    out[pos] = '\0';
+    return pos;
+}
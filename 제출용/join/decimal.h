@@ -0,0 +1,19 @@
+#ifndef DECIMAL_H
+#define DECIMAL_H
+
+#include <stdint.h>
+
+// 소수점 둘째 자리 고정소수점 (센트 단위 64비트 정수)
+// C_ACCTBAL, O_TOTALPRICE 저장용: 파싱/출력이 로케일과 무관하고 합산이 정확함
+typedef int64_t Decimal;
+
+#define DECIMAL_SCALE 100
+#define DECIMAL_STR_MAX 24  // 부호 + 19자리 + '.' + NUL 여유
+
+// [p, end) 구간의 "123.45" 형식 문자열을 센트 단위로 변환 (셋째 자리에서 반올림)
+Decimal decimal_parse(const char *p, const char *end);
+
+// 센트 값을 "123.45" 형식으로 기록 (NUL 종료), 반환값: 문자열 길이
+int decimal_format(Decimal value, char *out);
+
+#endif
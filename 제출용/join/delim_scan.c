@@ -0,0 +1,67 @@
+#include "delim_scan.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// ========================================
+// 구분자 스캐너 (Delimiter Scanner)
+// - 블록 전체를 SIMD로 한 번 훑어 필드 경계('|')와 레코드 경계('\n')를 찾음
+// - AVX2(32바이트) -> SSE2(16바이트) -> 스칼라 순으로 처리
+// - 파서는 바이트 단위 복사 없이 위치 배열만 보고 필드를 잘라냄
+// ========================================
+
+// 비교 결과 비트마스크에서 set된 위치를 순서대로 기록
+static inline size_t emit_mask(uint32_t mask, size_t base, uint32_t *out, size_t n) {
+    while (mask) {
+        out[n++] = (uint32_t)(base + __builtin_ctz(mask));
+        mask &= mask - 1;  // 최하위 비트 제거
+    }
+    return n;
+}
+
+size_t delim_scan(const char *data, size_t begin, size_t end, uint32_t *out) {
+    size_t n = 0;
+    size_t i = begin;
+
+#if defined(__AVX2__)
+    const __m256i pipe32 = _mm256_set1_epi8('|');
+    const __m256i newline32 = _mm256_set1_epi8('\n');
+    for (; i + 32 <= end; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(data + i));
+        __m256i hit = _mm256_or_si256(_mm256_cmpeq_epi8(v, pipe32),
+                                      _mm256_cmpeq_epi8(v, newline32));
+        n = emit_mask((uint32_t)_mm256_movemask_epi8(hit), i, out, n);
+    }
+#endif
+
+#if defined(__SSE2__)
+    const __m128i pipe16 = _mm_set1_epi8('|');
+    const __m128i newline16 = _mm_set1_epi8('\n');
+    for (; i + 16 <= end; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i hit = _mm_or_si128(_mm_cmpeq_epi8(v, pipe16),
+                                   _mm_cmpeq_epi8(v, newline16));
+        n = emit_mask((uint32_t)_mm_movemask_epi8(hit), i, out, n);
+    }
+#endif
+
+    // 나머지 바이트 (또는 SIMD 미지원 환경) 스칼라 처리
+    for (; i < end; i++) {
+        if (data[i] == '|' || data[i] == '\n') {
+            out[n++] = (uint32_t)i;
+        }
+    }
+
+    return n;
+}
+
+const char* delim_scan_impl(void) {
+#if defined(__AVX2__)
+    return "AVX2";
+#elif defined(__SSE2__)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
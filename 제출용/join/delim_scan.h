@@ -0,0 +1,18 @@
+#ifndef DELIM_SCAN_H
+#define DELIM_SCAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 한 번에 스캔하는 윈도우 크기 (바이트)
+// 출력 배열은 윈도우 크기만큼의 위치를 담을 수 있어야 함
+#define DELIM_SCAN_WINDOW 4096
+
+// data[begin, end) 구간에서 '|'와 '\n'의 위치를 찾아 out에 순서대로 기록
+// 반환값: 찾은 구분자 수 (out은 최소 end - begin개의 공간 필요)
+size_t delim_scan(const char *data, size_t begin, size_t end, uint32_t *out);
+
+// 컴파일 시 선택된 구현 이름 ("AVX2", "SSE2", "scalar")
+const char* delim_scan_impl(void);
+
+#endif
@@ -0,0 +1,37 @@
+#include <stdio.h>
+#include <string.h>
+#include "direct_table.h"
+
+// ========================================
+// 직접 주소 테이블 모듈 (Direct Table Module)
+// - 슬롯당 4바이트: 희소도 4배까지도 해시 슬롯(16바이트, 적재율 0.5)보다 작음
+// ========================================
+
+int direct_table_is_dense(long min_key, long max_key, size_t count) {
+    if (count == 0 || max_key < min_key) {
+        return 0;
+    }
+    uint64_t range = (uint64_t)max_key - (uint64_t)min_key + 1;
+    return range <= (uint64_t)count * DIRECT_TABLE_MAX_SPARSITY;
+}
+
+size_t direct_table_arena_bytes(size_t count) {
+    return arena_size_for(sizeof(DirectTable)) +
+           arena_size_for(sizeof(int32_t) * count * DIRECT_TABLE_MAX_SPARSITY);
+}
+
+DirectTable* direct_table_create(Arena *arena, long min_key, long max_key) {
+    uint64_t range = (uint64_t)max_key - (uint64_t)min_key + 1;
+    DirectTable *table = (DirectTable *)arena_alloc(arena, sizeof(DirectTable));
+    int32_t *index = (int32_t *)arena_alloc(arena, sizeof(int32_t) * range);
+    if (!table || !index) {
+        fprintf(stderr, "직접 주소 테이블 할당 실패 (%lu개)\n", (unsigned long)range);
+        return NULL;
+    }
+
+    table->min_key = min_key;
+    table->range = range;
+    table->index = index;
+    memset(index, 0xFF, sizeof(int32_t) * range);  // -1 = 없음
+    return table;
+}
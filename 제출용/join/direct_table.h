@@ -0,0 +1,55 @@
+#ifndef DIRECT_TABLE_H
+#define DIRECT_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "arena.h"
+
+// ========================================
+// 직접 주소 테이블 (Direct-address Table)
+// - 키 범위가 촘촘한 정수 키(TPC-H C_CUSTKEY = 1..N)용: index[key - min_key] = Customer 인덱스
+// - 탐색은 범위 검사 1번 + 배열 읽기 1번 (해시 계산/탐사 없음)
+// - 키 범위가 레코드 수의 DIRECT_TABLE_MAX_SPARSITY배를 넘거나 중복 키가 있으면 사용하지 않음
+// ========================================
+
+#define DIRECT_TABLE_MAX_SPARSITY 4  // 허용하는 (키 범위 / 레코드 수) 최댓값
+
+typedef struct {
+    long min_key;
+    uint64_t range;         // max_key - min_key + 1
+    int32_t *index;         // 키별 Customer 인덱스 (-1 = 없음)
+} DirectTable;
+
+// count개 레코드의 키 범위 [min_key, max_key]가 직접 주소 방식에 맞는지 판단
+int direct_table_is_dense(long min_key, long max_key, size_t count);
+
+// [min_key, max_key] 범위의 빈 테이블을 아레나에 생성 (공간 부족 시 NULL)
+DirectTable* direct_table_create(Arena *arena, long min_key, long max_key);
+
+// count개 레코드용 테이블이 차지하는 최대 아레나 공간 (아레나 크기 산정용)
+size_t direct_table_arena_bytes(size_t count);
+
+// (key, value) 삽입 (성공 1, 이미 같은 키가 있으면 0 → 해시 테이블로 대체)
+static inline int direct_table_insert(DirectTable *table, long key, int32_t value) {
+    int32_t *slot = &table->index[(uint64_t)key - (uint64_t)table->min_key];
+    if (*slot >= 0) {
+        return 0;
+    }
+    *slot = value;
+    return 1;
+}
+
+// 여러 스레드가 동시에 삽입하는 버전 (성공 1, 중복 키 0)
+static inline int direct_table_insert_atomic(DirectTable *table, long key, int32_t value) {
+    int32_t expected = -1;
+    return __atomic_compare_exchange_n(&table->index[(uint64_t)key - (uint64_t)table->min_key], &expected, value,
+                                       0, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+// key의 Customer 인덱스 (없으면 -1)
+static inline int32_t direct_table_find(const DirectTable *table, long key) {
+    uint64_t offset = (uint64_t)key - (uint64_t)table->min_key;  // min_key보다 작으면 매우 큰 값
+    return offset < table->range ? table->index[offset] : -1;
+}
+
+#endif
@@ -1,23 +1,152 @@
-#define _POSIX_C_SOURCE 200809L
+#define _GNU_SOURCE  // memrchr, madvise, O_DIRECT
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <pthread.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "disk_reader.h"
+#include "delim_scan.h"
+#include "column_cache.h"
+#include "zone_map.h"
 
 // ========================================
 // 디스크 리더 모듈 (Disk Reader Module)
 // - 블록 단위 파일 읽기로 I/O 효율성 향상
-// - Customer/Order 레코드 파싱 및 구조체 변환
-// - I/O 카운트 추적으로 성능 모니터링
+// - mmap 모드: 스레드 간 페이지 캐시 공유, 리더별 복사 제거
+// - fread 모드: 보조 스레드의 이중 버퍼 선읽기로 I/O 대기와 파싱을 겹침
+// - O_DIRECT 모드: 페이지 캐시를 거치지 않는 정렬 읽기 (실제 장치 처리량 측정용)
+// - SIMD 구분자 스캔 기반 Customer/Order 레코드 파싱 및 구조체 변환
+// - 리더별 I/O/파싱 통계로 성능 모니터링 (스레드 간 공유 카운터 없음)
+// - Order 리더는 존 맵으로 키 범위/날짜 조건과 겹칠 수 없는 청크를 건너뜀
 // ========================================
 
-static long total_io_count = 0;
+static inline long now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
 
 // ========================================
 // 1. 디스크 리더 생성 및 초기화
 // ========================================
 
+static DiskReaderMode default_mode = DISK_READER_MODE_MMAP;
+static int default_date_filter = 0;
+static int default_date_min = 0;
+static int default_date_max = 0;
+
+static int prefetch_init(DiskReader *reader);
+static void prefetch_start(DiskReader *reader);
+
+void disk_reader_set_default_mode(DiskReaderMode mode) {
+    default_mode = mode;
+}
+
+DiskReaderMode disk_reader_get_default_mode(void) {
+    return default_mode;
+}
+
+void disk_reader_set_default_date_filter(int min_date, int max_date) {
+    default_date_filter = 1;
+    default_date_min = min_date;
+    default_date_max = max_date;
+}
+
+const char* disk_reader_mode_name(DiskReaderMode mode) {
+    switch (mode) {
+    case DISK_READER_MODE_FREAD:    return "fread";
+    case DISK_READER_MODE_MMAP:     return "mmap";
+    case DISK_READER_MODE_COLUMNAR: return "columnar";
+    case DISK_READER_MODE_DIRECT:   return "direct";
+    }
+    return "unknown";
+}
+
+// 블록 버퍼 할당: O_DIRECT 읽기 위치(buffer + 여유 공간)가 정렬되도록 페이지 정렬
+static char* alloc_block_buffer(size_t size) {
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, DIRECT_IO_ALIGN, size) != 0) {
+        return NULL;
+    }
+    return (char *)ptr;
+}
+
+// O_DIRECT 모드 초기화: 블록 크기와 여유 공간을 정렬 단위로 맞추고
+// 첫 정렬 블록을 시험 삼아 읽어 실제로 직접 I/O가 가능한지 확인 (실패 시 0 반환)
+static int open_direct(DiskReader *reader, const char *filename) {
+    int fd = open(filename, O_RDONLY | O_DIRECT);
+    if (fd < 0) {
+        return 0;
+    }
+
+    char *probe = alloc_block_buffer(DIRECT_IO_ALIGN);
+    ssize_t got = probe ? pread(fd, probe, DIRECT_IO_ALIGN, 0) : -1;
+    free(probe);
+    struct stat st;
+    if (got < 0 || fstat(fd, &st) != 0) {
+        close(fd);
+        return 0;
+    }
+    reader->file_size = st.st_size;
+
+    size_t align = DIRECT_IO_ALIGN;
+    size_t block = ((size_t)reader->block_size + align - 1) & ~(align - 1);
+    size_t reserve = ((block / 5) + align - 1) & ~(align - 1);
+    reader->direct_fd = fd;
+    reader->direct_offset = 0;
+    reader->block_size = (int)block;
+    reader->buffer_size = (int)(reserve + block);
+    return 1;
+}
+
+// mmap 모드 초기화: 파일 전체를 읽기 전용으로 매핑 (실패 시 0 반환)
+static int map_file(DiskReader *reader, const char *filename) {
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        perror("파일 열기 실패");
+        return 0;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return 0;
+    }
+
+    reader->map_size = (size_t)st.st_size;
+    reader->file_size = st.st_size;
+    reader->map = NULL;
+    if (reader->map_size > 0) {
+        void *addr = mmap(NULL, reader->map_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+            reader->map_size = 0;
+            close(fd);
+            return 0;
+        }
+        // 순차 스캔 힌트: 커널 readahead 확대 및 읽은 페이지 조기 회수
+        madvise(addr, reader->map_size, MADV_SEQUENTIAL);
+        reader->map = (const char *)addr;
+    }
+    close(fd);  // 매핑은 fd와 무관하게 유지됨
+
+    reader->map_offset = 0;
+    return 1;
+}
+
 DiskReader* disk_reader_open(const char *filename, const char *type, int block_size) {
+    DiskReader *reader = disk_reader_open_mode(filename, type, block_size, default_mode);
+    if (reader && default_date_filter && type && strcmp(type, "order") == 0) {
+        disk_reader_set_date_filter(reader, default_date_min, default_date_max);
+    }
+    return reader;
+}
+
+DiskReader* disk_reader_open_mode(const char *filename, const char *type, int block_size, DiskReaderMode mode) {
     // 파일 열기 및 DiskReader 구조체 초기화
     DiskReader *reader = (DiskReader *)malloc(sizeof(DiskReader));
     if (!reader) {
@@ -25,21 +154,121 @@ DiskReader* disk_reader_open(const char *filename, const char *type, int block_s
         return NULL;
     }
 
-    reader->file = fopen(filename, "rb");  // 바이너리 모드로 열기
-    if (!reader->file) {
-        perror("파일 열기 실패");
-        free(reader);
-        return NULL;
+    memset(&reader->stats, 0, sizeof(reader->stats));
+    reader->file = NULL;
+    reader->file_size = 0;
+    reader->block_offset = 0;
+    reader->locate_buffer = NULL;
+    reader->locate_offset = 0;
+    reader->locate_size = 0;
+    reader->range_start = 0;
+    reader->range_end = 0;
+    reader->data_offset = 0;
+    reader->read_from = 0;
+    reader->direct_fd = -1;
+    reader->direct_offset = 0;
+    reader->buffer = NULL;
+    reader->spare_buffer = NULL;
+    reader->prefetch = NULL;
+    reader->block = NULL;
+    reader->delims = NULL;
+    reader->batch_lines = NULL;
+    reader->batch_capacity = 0;
+    reader->columns = CUST_COL_ALL | ORDER_COL_ALL;
+    reader->key_filter = 0;
+    reader->key_min = 0;
+    reader->key_max = 0;
+    reader->date_filter = 0;
+    reader->date_min = 0;
+    reader->date_max = 0;
+    reader->zone_map = NULL;
+    reader->zone_next = 0;
+    reader->map = NULL;
+    reader->map_size = 0;
+    reader->map_offset = 0;
+    reader->cache = NULL;
+    reader->row_pos = 0;
+    reader->block_row = 0;
+    reader->rows_per_block = 0;
+    reader->block_size = block_size;
+    reader->buffer_size = 0;
+    reader->mode = mode;
+
+    // 컬럼 캐시 모드: 유효한 캐시가 없으면 mmap 모드로 대체
+    if (mode == DISK_READER_MODE_COLUMNAR) {
+        reader->cache = column_cache_open(filename, column_table_from_type(type));
+        if (reader->cache) {
+            // 원본 텍스트 기준 block_size 바이트에 해당하는 행 수를 한 블록으로 사용
+            long row_bytes = reader->cache->rows > 0 ? reader->cache->source_size / reader->cache->rows : 1;
+            long rows = block_size / (row_bytes > 0 ? row_bytes : 1);
+            reader->rows_per_block = rows > 0 ? (int)rows : 1;
+        } else {
+            fprintf(stderr, "컬럼 캐시 없음, mmap 모드로 대체: %s\n", filename);
+            reader->mode = DISK_READER_MODE_MMAP;
+        }
     }
 
-    // 블록 크기 설정 및 버퍼 할당
-    reader->block_size = block_size;
-    reader->buffer_size = block_size * 1.2;
-    reader->buffer = (char *)malloc(reader->buffer_size);
-    if (!reader->buffer) {
-        fprintf(stderr, "버퍼 메모리 할당 실패\n");
-        fclose(reader->file);
-        free(reader);
+    // mmap 모드: 매핑 실패 시 fread 모드로 대체
+    if (reader->mode == DISK_READER_MODE_MMAP && !map_file(reader, filename)) {
+        fprintf(stderr, "mmap 실패, fread 모드로 대체: %s\n", filename);
+        reader->mode = DISK_READER_MODE_FREAD;
+    }
+
+    // O_DIRECT 모드: 지원하지 않는 파일시스템이면 fread 모드로 대체
+    if (reader->mode == DISK_READER_MODE_DIRECT && !open_direct(reader, filename)) {
+        fprintf(stderr, "O_DIRECT 사용 불가, fread 모드로 대체: %s\n", filename);
+        reader->mode = DISK_READER_MODE_FREAD;
+    }
+
+    if (reader->mode == DISK_READER_MODE_FREAD) {
+        reader->file = fopen(filename, "rb");  // 바이너리 모드로 열기
+        if (!reader->file) {
+            perror("파일 열기 실패");
+            free(reader);
+            return NULL;
+        }
+        reader->buffer_size = block_size * 1.2;
+
+        struct stat st;
+        if (fstat(fileno(reader->file), &st) == 0) {
+            reader->file_size = st.st_size;
+        }
+    }
+
+    // 기본 담당 범위: 파일 전체 (컬럼 캐시 모드는 행 단위)
+    reader->range_end = reader->mode == DISK_READER_MODE_COLUMNAR ? reader->cache->rows : reader->file_size;
+
+    // Order 리더: 존 맵이 있으면 로드 (원본/컬럼 캐시와 범위가 맞지 않으면 사용하지 않음)
+    if (type && strcmp(type, "order") == 0) {
+        reader->zone_map = zone_map_open(filename);
+        if (reader->zone_map) {
+            const ZoneMapEntry *last = &reader->zone_map->entries[reader->zone_map->count - 1];
+            long end = reader->mode == DISK_READER_MODE_COLUMNAR ? last->row_end : last->byte_end;
+            if (end != reader->range_end) {
+                zone_map_close(reader->zone_map);
+                reader->zone_map = NULL;
+            }
+        }
+    }
+
+    if (reader->mode == DISK_READER_MODE_FREAD || reader->mode == DISK_READER_MODE_DIRECT) {
+        // 이중 버퍼 할당 (현재 블록 + 선읽기 블록, 데이터 영역은 페이지 정렬)
+        reader->buffer = alloc_block_buffer(reader->buffer_size);
+        reader->spare_buffer = alloc_block_buffer(reader->buffer_size);
+        if (!reader->buffer || !reader->spare_buffer || !prefetch_init(reader)) {
+            fprintf(stderr, "버퍼 메모리 할당 실패\n");
+            disk_reader_close(reader);
+            return NULL;
+        }
+        reader->block = reader->buffer;
+        prefetch_start(reader);  // 첫 블록 읽기 시작
+    }
+
+    // 구분자 위치 배열 할당 (윈도우 단위 스캔 결과 저장)
+    reader->delims = (uint32_t *)malloc(sizeof(uint32_t) * DELIM_SCAN_WINDOW);
+    if (!reader->delims) {
+        fprintf(stderr, "구분자 배열 할당 실패\n");
+        disk_reader_close(reader);
         return NULL;
     }
 
@@ -48,137 +277,635 @@ DiskReader* disk_reader_open(const char *filename, const char *type, int block_s
     reader->current_block = 0;
     reader->records_in_buffer = 0;
     reader->current_record = 0;
-    memset(reader->buffer, 0, reader->buffer_size);
+    reader->carry_size = 0;
+    reader->delim_count = 0;
+    reader->delim_next = 0;
+    reader->scan_pos = 0;
 
     return reader;
 }
 
 // ========================================
 // 2. 블록 단위 데이터 로딩 (내부 함수)
+// - 블록은 항상 줄 경계('\n')에서 끝나도록 잘라서 레코드가 블록을 걸치지 않게 함
+// ========================================
+
+// 마지막 개행 다음 위치 반환 (개행이 없으면 len 그대로: 한 줄이 블록보다 긴 경우)
+static size_t trim_to_line(const char *data, size_t len) {
+    const char *last = memrchr(data, '\n', len);
+    return last ? (size_t)(last - data) + 1 : len;
+}
+
+// 현재 블록 시작 위치 (텍스트: 파일 바이트 위치, 컬럼 캐시: 행 번호)
+static inline long block_position(const DiskReader *reader) {
+    if (reader->mode == DISK_READER_MODE_COLUMNAR) {
+        return reader->block_row;
+    }
+    if (reader->mode == DISK_READER_MODE_MMAP) {
+        return reader->block - reader->map;
+    }
+    return reader->block_offset;
+}
+
+// ========================================
+// 존 맵 청크 건너뛰기 (Zone Map Skipping)
+// - 키 범위/날짜 조건이 있을 때 청크의 최소/최대값이 조건과 겹치지 않으면 청크 전체를 건너뜀
+// - 청크 경계는 줄 시작이므로 건너뛴 뒤에도 레코드 경계가 유지됨
 // ========================================
 
+static inline int zone_active(const DiskReader *reader) {
+    return reader->zone_map && (reader->key_filter || reader->date_filter);
+}
+
+static inline int zone_entry_may_match(const DiskReader *reader, const ZoneMapEntry *entry) {
+    if (reader->key_filter && (entry->custkey_max < reader->key_min || entry->custkey_min > reader->key_max)) {
+        return 0;
+    }
+    if (reader->date_filter && (entry->date_max < reader->date_min || entry->date_min > reader->date_max)) {
+        return 0;
+    }
+    return 1;
+}
+
+// pos(텍스트: 파일 바이트 위치, 컬럼 캐시: 행 번호)부터 조건을 만족할 수 있는 첫 위치
+// pos가 속한 청크가 후보이면 pos 그대로, 담당 범위 끝까지 후보가 없으면 range_end
+// *candidate_end: 반환 위치가 속한 후보 청크의 끝 (이 위치 전까지는 다시 확인할 필요 없음)
+static long zone_skip_target(DiskReader *reader, long pos, long *candidate_end) {
+    const ZoneMap *zm = reader->zone_map;
+    int by_row = reader->mode == DISK_READER_MODE_COLUMNAR;
+    long idx = zone_map_find(zm, pos, by_row);
+    long first = idx;
+
+    while (idx < zm->count && !zone_entry_may_match(reader, &zm->entries[idx])) {
+        const ZoneMapEntry *entry = &zm->entries[idx];
+        if ((by_row ? entry->row_start : entry->byte_start) >= reader->range_end) {
+            break;
+        }
+        idx++;
+    }
+
+    if (idx == zm->count) {
+        *candidate_end = LONG_MAX;
+        return reader->range_end;
+    }
+    const ZoneMapEntry *entry = &zm->entries[idx];
+    long start = by_row ? entry->row_start : entry->byte_start;
+    if (start >= reader->range_end) {
+        *candidate_end = LONG_MAX;
+        return reader->range_end;
+    }
+    *candidate_end = by_row ? entry->row_end : entry->byte_end;
+    return idx == first ? pos : start;
+}
+
+// 실제로 건너뛴 구간 [from, to)를 통계에 기록 (텍스트: 바이트, 컬럼 캐시: 행 → 원본 바이트 환산)
+// 청크 수는 구간 안에서 시작하는 청크만 셈: 블록 경계에 걸친 청크는 앞 구간에서 한 번만 셈
+static void zone_account(DiskReader *reader, long from, long to) {
+    const ZoneMap *zm = reader->zone_map;
+    int by_row = reader->mode == DISK_READER_MODE_COLUMNAR;
+
+    for (long idx = zone_map_find(zm, from, by_row); idx < zm->count; idx++) {
+        const ZoneMapEntry *entry = &zm->entries[idx];
+        long start = by_row ? entry->row_start : entry->byte_start;
+        long end = by_row ? entry->row_end : entry->byte_end;
+        if (start >= to) {
+            break;
+        }
+        long span = (to < end ? to : end) - (from > start ? from : start);
+        if (span <= 0) {
+            continue;
+        }
+        if (start >= from) {
+            reader->stats.zone_chunks++;
+        }
+        reader->stats.zone_bytes += by_row
+            ? span * (entry->byte_end - entry->byte_start) / (end - start)
+            : span;
+    }
+}
+
+// 일괄 읽기: 다음 레코드가 건너뛸 청크에 있으면 후보 청크 시작으로 이동 (블록 밖이면 블록 소진)
+static inline void zone_check(DiskReader *reader) {
+    if (!zone_active(reader)) {
+        return;
+    }
+    long base = block_position(reader);
+    long pos = base + reader->current_record;
+    if (pos < reader->zone_next) {
+        return;  // 이미 확인한 후보 청크 안
+    }
+
+    long target = zone_skip_target(reader, pos, &reader->zone_next);
+    if (target > pos) {
+        // 블록 끝 이후 구간은 다음 블록 이동(map/cache_next_block, zone_seek)에서 기록
+        long offset = target - base;
+        reader->current_record = offset < reader->records_in_buffer ? (int)offset : reader->records_in_buffer;
+        zone_account(reader, pos, base + reader->current_record);
+        reader->delim_count = 0;  // 스캔해 둔 구분자는 버리고 새 위치부터 다시 스캔
+        reader->delim_next = 0;
+        reader->scan_pos = reader->current_record;
+    }
+}
+
+// mmap 모드: 복사 없이 매핑 내부의 다음 블록을 가리키도록 이동
+static size_t map_next_block(DiskReader *reader) {
+    // 존 맵: 블록 시작이 건너뛸 청크 안이면 후보 청크로 이동 (건너뛴 페이지는 읽지 않음)
+    if (zone_active(reader) && reader->map_offset < (size_t)reader->range_end) {
+        long target = zone_skip_target(reader, (long)reader->map_offset, &reader->zone_next);
+        if (target > (long)reader->map_offset) {
+            zone_account(reader, (long)reader->map_offset, target);
+            reader->map_offset = target;
+        }
+    }
+    if (reader->map_offset >= (size_t)reader->range_end) {
+        return 0;  // 읽을 데이터 없음 (담당 범위 끝)
+    }
+
+    size_t len = reader->range_end - reader->map_offset;
+    if (len > (size_t)reader->block_size) {
+        len = trim_to_line(reader->map + reader->map_offset, reader->block_size);
+    }
+    reader->block = reader->map + reader->map_offset;
+    reader->map_offset += len;
+
+    // 다음 블록 선읽기 요청 (madvise는 페이지 정렬 주소 필요)
+    if (reader->map_offset < (size_t)reader->range_end) {
+        size_t page = (size_t)sysconf(_SC_PAGESIZE);
+        size_t start = reader->map_offset & ~(page - 1);
+        size_t ahead = reader->range_end - start;
+        if (ahead > (size_t)reader->block_size) {
+            ahead = reader->block_size;
+        }
+        madvise((void *)(reader->map + start), ahead, MADV_WILLNEED);
+    }
+
+    return len;
+}
+
+// ========================================
+// fread 모드 이중 버퍼 선읽기 (Double-buffered Prefetch)
+// - 보조 스레드가 블록 N+1을 여분 버퍼로 fread하는 동안 블록 N을 파싱
+// - 스레드 생성 실패 시 요청 시점에 동기 fread로 대체
+// ========================================
+
+typedef enum {
+    PREFETCH_IDLE,       // 진행 중인 읽기 없음 (EOF 도달 또는 리셋 직후)
+    PREFETCH_REQUESTED,  // 보조 스레드가 읽는 중
+    PREFETCH_DONE        // 읽기 완료, 결과 대기
+} PrefetchState;
+
+struct DiskPrefetch {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int async;             // 보조 스레드 사용 여부 (0이면 동기 fread)
+    int stop;
+    PrefetchState state;
+    char *dest;            // 읽을 위치 (여분 버퍼의 데이터 영역)
+    size_t bytes;          // 읽은 바이트 수
+};
+
+// 다음 block_size 바이트를 dest로 읽기 (O_DIRECT는 정렬된 pread, 그 외 fread)
+static size_t read_raw(DiskReader *reader, char *dest) {
+    if (reader->mode != DISK_READER_MODE_DIRECT) {
+        return fread(dest, 1, reader->block_size, reader->file);
+    }
+
+    size_t total = 0;
+    while (total < (size_t)reader->block_size) {
+        ssize_t got = pread(reader->direct_fd, dest + total, reader->block_size - total,
+                            reader->direct_offset + total);
+        if (got <= 0) {
+            if (got < 0) {
+                perror("pread (O_DIRECT)");
+            }
+            break;
+        }
+        total += got;
+        if (got % DIRECT_IO_ALIGN != 0) {
+            break;  // 정렬 단위보다 짧게 읽힘 = 파일 끝
+        }
+    }
+    reader->direct_offset += total;
+    return total;
+}
+
+static void* prefetch_worker(void *arg) {
+    DiskReader *reader = (DiskReader *)arg;
+    DiskPrefetch *pf = reader->prefetch;
+
+    pthread_mutex_lock(&pf->lock);
+    while (1) {
+        while (pf->state != PREFETCH_REQUESTED && !pf->stop) {
+            pthread_cond_wait(&pf->cond, &pf->lock);
+        }
+        if (pf->stop) {
+            break;
+        }
+
+        // 잠금 없이 읽기 수행 (파일 핸들/오프셋은 이 스레드만 사용 중)
+        char *dest = pf->dest;
+        pthread_mutex_unlock(&pf->lock);
+        size_t bytes = read_raw(reader, dest);
+        pthread_mutex_lock(&pf->lock);
+
+        pf->bytes = bytes;
+        pf->state = PREFETCH_DONE;
+        pthread_cond_broadcast(&pf->cond);
+    }
+    pthread_mutex_unlock(&pf->lock);
+    return NULL;
+}
+
+// 여분 버퍼로 다음 블록 읽기 요청
+static void prefetch_start(DiskReader *reader) {
+    DiskPrefetch *pf = reader->prefetch;
+    char *dest = reader->spare_buffer + (reader->buffer_size - reader->block_size);
+
+    if (!pf->async) {
+        pf->bytes = read_raw(reader, dest);
+        pf->state = PREFETCH_DONE;
+        return;
+    }
+
+    pthread_mutex_lock(&pf->lock);
+    pf->dest = dest;
+    pf->state = PREFETCH_REQUESTED;
+    pthread_cond_broadcast(&pf->cond);
+    pthread_mutex_unlock(&pf->lock);
+}
+
+// 요청한 읽기가 끝날 때까지 대기 (반환값: 읽은 바이트, 요청이 없었으면 0)
+static size_t prefetch_wait(DiskReader *reader) {
+    DiskPrefetch *pf = reader->prefetch;
+    size_t bytes = 0;
+
+    pthread_mutex_lock(&pf->lock);
+    while (pf->state == PREFETCH_REQUESTED) {
+        pthread_cond_wait(&pf->cond, &pf->lock);
+    }
+    if (pf->state == PREFETCH_DONE) {
+        bytes = pf->bytes;
+    }
+    pf->state = PREFETCH_IDLE;
+    pthread_mutex_unlock(&pf->lock);
+
+    return bytes;
+}
+
+static int prefetch_init(DiskReader *reader) {
+    DiskPrefetch *pf = (DiskPrefetch *)calloc(1, sizeof(DiskPrefetch));
+    if (!pf) {
+        return 0;
+    }
+    pthread_mutex_init(&pf->lock, NULL);
+    pthread_cond_init(&pf->cond, NULL);
+    pf->state = PREFETCH_IDLE;
+    reader->prefetch = pf;
+
+    pf->async = pthread_create(&pf->thread, NULL, prefetch_worker, reader) == 0;
+    if (!pf->async) {
+        fprintf(stderr, "선읽기 스레드 생성 실패, 동기 읽기로 대체\n");
+    }
+    return 1;
+}
+
+static void prefetch_destroy(DiskReader *reader) {
+    DiskPrefetch *pf = reader->prefetch;
+    if (!pf) {
+        return;
+    }
+    if (pf->async) {
+        pthread_mutex_lock(&pf->lock);
+        pf->stop = 1;
+        pthread_cond_broadcast(&pf->cond);
+        pthread_mutex_unlock(&pf->lock);
+        pthread_join(pf->thread, NULL);
+    }
+    pthread_mutex_destroy(&pf->lock);
+    pthread_cond_destroy(&pf->cond);
+    free(pf);
+    reader->prefetch = NULL;
+}
+
+// fread/O_DIRECT 모드: 다음 선읽기 위치를 target(줄 시작)으로 옮김 (선읽기가 멈춘 상태에서 호출)
+static void zone_seek(DiskReader *reader, long target) {
+    reader->carry_size = 0;
+    reader->read_from = target;
+    if (target >= reader->range_end) {
+        reader->data_offset = reader->range_end;  // 남은 청크가 모두 건너뛸 대상
+    } else if (reader->mode == DISK_READER_MODE_DIRECT) {
+        // O_DIRECT는 정렬된 위치부터 읽고 target 앞부분은 read_next_block에서 버림
+        reader->direct_offset = target & ~(long)(DIRECT_IO_ALIGN - 1);
+        reader->data_offset = reader->direct_offset;
+    } else {
+        fseek(reader->file, target, SEEK_SET);
+        reader->data_offset = target;
+    }
+}
+
+// fread 모드: 선읽기된 블록 앞에 이전 블록의 미완성 줄을 이어 붙이고 버퍼 교체
+// 버퍼 구조: [여유 공간 (buffer_size - block_size)][새로 읽은 block_size]
+static size_t read_next_block(DiskReader *reader) {
+    int reserve = reader->buffer_size - reader->block_size;
+    char *data_start = reader->spare_buffer + reserve;
+    int carry = reader->carry_size;
+
+    size_t bytes_read = prefetch_wait(reader);
+    int more = bytes_read == (size_t)reader->block_size;  // 파일 끝이 아니면 1
+    long offset = reader->data_offset;  // data_start에 해당하는 파일 위치
+    reader->data_offset += bytes_read;
+
+    // 담당 범위 앞부분 버리기 (O_DIRECT 정렬 때문에 range_start/건너뛴 위치 앞부터 읽은 경우)
+    if (offset < reader->read_from) {
+        size_t skip = reader->read_from - offset;
+        if (skip > bytes_read) {
+            skip = bytes_read;
+        }
+        data_start += skip;
+        bytes_read -= skip;
+        offset += skip;
+    }
+
+    // 담당 범위 끝 이후는 버림 (range_end는 줄 경계이므로 잘린 줄 없음)
+    if (offset + (long)bytes_read >= reader->range_end) {
+        bytes_read = reader->range_end > offset ? reader->range_end - offset : 0;
+        more = 0;
+    }
+
+    // 미완성 줄을 새 데이터 시작 위치 바로 앞으로 복사
+    if (carry > 0) {
+        memcpy(data_start - carry, reader->block + reader->records_in_buffer, carry);
+    }
+
+    size_t len = carry + bytes_read;
+    if (len == 0) {
+        return 0;  // 읽을 데이터 없음
+    }
+
+    // 버퍼 교체: 방금 다 쓴 버퍼가 다음 선읽기 대상이 됨
+    char *consumed = reader->buffer;
+    reader->buffer = reader->spare_buffer;
+    reader->spare_buffer = consumed;
+
+    reader->block = data_start - carry;
+    reader->block_offset = offset - carry;
+    reader->carry_size = 0;
+    if (more) {
+        // 파일 끝이 아니면 마지막 줄의 잘린 부분은 다음 블록으로 넘김
+        size_t complete = trim_to_line(reader->block, len);
+        if (len - complete <= (size_t)reserve) {
+            reader->carry_size = len - complete;
+            len = complete;
+        }
+
+        // 존 맵: 다음 블록이 건너뛸 청크에서 시작하면 미완성 줄을 버리고 후보 청크부터 읽음
+        // (블록이 줄 경계에서 끝난 경우만: 미완성 줄의 시작이 곧 다음 줄 시작)
+        // 현재 블록은 아직 파싱 전이므로 zone_next는 그대로 두고 별도 커서로 판정
+        if (zone_active(reader) && reader->block[len - 1] == '\n') {
+            long next = reader->data_offset - reader->carry_size;
+            long lookahead_end;
+            long target = zone_skip_target(reader, next, &lookahead_end);
+            if (target > next) {
+                zone_account(reader, next, target);
+                zone_seek(reader, target);
+            }
+        }
+
+        // 현재 블록을 파싱하는 동안 다음 블록 읽기 시작
+        if (reader->data_offset < reader->range_end) {
+            prefetch_start(reader);
+        }
+    }
+
+    return len;
+}
+
+// 컬럼 캐시 모드: 다음 rows_per_block개 행을 현재 블록으로 지정 (반환값: 행 수)
+static size_t cache_next_block(DiskReader *reader) {
+    // 존 맵: 블록 시작 행이 건너뛸 청크 안이면 후보 청크의 첫 행으로 이동
+    if (zone_active(reader) && reader->row_pos < reader->range_end) {
+        long target = zone_skip_target(reader, reader->row_pos, &reader->zone_next);
+        if (target > reader->row_pos) {
+            zone_account(reader, reader->row_pos, target);
+            reader->row_pos = target;
+        }
+    }
+
+    long remaining = reader->range_end - reader->row_pos;
+    if (remaining <= 0) {
+        return 0;  // 읽을 데이터 없음
+    }
+
+    long rows = remaining < reader->rows_per_block ? remaining : reader->rows_per_block;
+    reader->block_row = reader->row_pos;
+    reader->row_pos += rows;
+    return rows;
+}
+
 static int load_block(DiskReader *reader) {
-    // 블록 단위로 파일에서 데이터 읽기
-    size_t bytes_read = fread(reader->buffer, 1, reader->block_size, reader->file);
+    // 블록 단위로 파일에서 데이터 읽기 (선읽기 대기/페이지 폴트 포함 시간 측정)
+    long t0 = now_ns();
+    size_t bytes_read;
+    if (reader->mode == DISK_READER_MODE_COLUMNAR) {
+        bytes_read = cache_next_block(reader);
+    } else if (reader->mode == DISK_READER_MODE_MMAP) {
+        bytes_read = map_next_block(reader);
+    } else {
+        bytes_read = read_next_block(reader);
+    }
+    reader->stats.read_ns += now_ns() - t0;
     if (bytes_read == 0) {
         return 0;  // 읽을 데이터 없음
     }
 
-    // I/O 카운트 증가 및 상태 업데이트
-    __sync_fetch_and_add(&total_io_count, 1);  // 원자적 증가
+    // 리더별 통계 및 상태 업데이트 (컬럼 캐시 모드는 행 수를 원본 바이트로 환산)
+    reader->stats.blocks++;
+    if (reader->mode == DISK_READER_MODE_COLUMNAR) {
+        long converted = (long)bytes_read * reader->cache->source_size / reader->cache->rows;
+        reader->stats.bytes += converted;
+        reader->stats.converted_bytes += converted;
+    } else {
+        reader->stats.bytes += bytes_read;
+    }
     reader->buffer_valid = 1;
     reader->current_block++;
     reader->current_record = 0;
     reader->records_in_buffer = bytes_read;
+    reader->delim_count = 0;
+    reader->delim_next = 0;
+    reader->scan_pos = 0;
 
     return 1;
 }
 
 // ========================================
-// 3. 버퍼에서 한 줄 읽기 (내부 함수)
+// 3. 레코드 경계 탐색 (내부 함수)
+// - 블록을 DELIM_SCAN_WINDOW 단위로 SIMD 스캔하여 구분자 위치를 얻고
+//   한 레코드의 필드 끝 위치들을 돌려줌 (줄 복사/strtok_r 없음)
 // ========================================
 
-static int read_line(DiskReader *reader, char *line, int max_size) {
-    int line_idx = 0;
-    
-    while (line_idx < max_size - 1) {
-        // 버퍼가 비었으면 새 블록 로드
-        if (reader->current_record >= reader->records_in_buffer) {
-            if (!load_block(reader)) {
-                // 파일 끝: 버퍼에 남은 데이터 처리
-                if (line_idx > 0) {
-                    line[line_idx] = '\0';
-                    return 1;
-                }
-                return 0;
-            }
+// 다음 구분자 위치 (현재 블록을 모두 소비했으면 0 반환)
+static inline int next_delim(DiskReader *reader, uint32_t *pos) {
+    if (reader->delim_next == reader->delim_count) {
+        if (reader->scan_pos >= reader->records_in_buffer) {
+            return 0;
+        }
+        int end = reader->scan_pos + DELIM_SCAN_WINDOW;
+        if (end > reader->records_in_buffer) {
+            end = reader->records_in_buffer;
         }
-        
-        char ch = reader->buffer[reader->current_record++];
-        
-        if (ch == '\n') {
-            line[line_idx] = '\0';
-            return 1;
+        reader->delim_count = (int)delim_scan(reader->block, reader->scan_pos, end, reader->delims);
+        reader->delim_next = 0;
+        reader->scan_pos = end;
+        if (reader->delim_count == 0) {
+            return next_delim(reader, pos);  // 구분자 없는 윈도우 (긴 필드)
         }
-        
-        line[line_idx++] = ch;
     }
-    
-    line[max_size - 1] = '\0';
+    *pos = reader->delims[reader->delim_next++];
     return 1;
 }
 
-// ========================================
-// 4. Customer 레코드 읽기 및 파싱
-// ========================================
+// 현재 블록에서 한 레코드의 필드 끝 위치를 ends에 기록 (i번째 필드 = [이전 끝 + 1, ends[i]))
+// 반환값: 필드 수 (0이면 현재 블록 소진), *line_start에 레코드 시작 위치
+static int scan_record_in_block(DiskReader *reader, uint32_t *ends, int max_fields, uint32_t *line_start) {
+    int n = 0;
+    uint32_t pos;
 
-int disk_reader_read_customer(DiskReader *reader, CustomerRecord *record) {
-    char line[512];
+    while (1) {
+        if (!next_delim(reader, &pos)) {
+            if (reader->current_record >= reader->records_in_buffer) {
+                return 0;  // 블록 소진 (블록은 줄 경계에서 끝나므로 n == 0)
+            }
+            // 개행 없이 끝난 파일의 마지막 줄
+            pos = reader->records_in_buffer;
+        } else if (reader->block[pos] == '|') {
+            if (n < max_fields) {
+                ends[n++] = pos;
+            }
+            continue;
+        }
 
-    // 블록 버퍼에서 한 줄 읽기
-    if (!read_line(reader, line, sizeof(line))) {
-        return 0;  // EOF
+        // 개행: 레코드 종료 (빈 줄은 건너뜀)
+        if (n == 0 && pos == (uint32_t)reader->current_record) {
+            reader->current_record = pos + 1;
+            continue;
+        }
+        if (n < max_fields) {
+            ends[n++] = pos;
+        }
+        *line_start = reader->current_record;
+        reader->current_record = pos + 1;
+        return n;
+    }
+}
+
+// 블록 경계를 넘어 다음 레코드 탐색 (반환값 0이면 EOF)
+static int scan_record(DiskReader *reader, uint32_t *ends, int max_fields, uint32_t *line_start) {
+    while (1) {
+        int n = scan_record_in_block(reader, ends, max_fields, line_start);
+        if (n > 0) {
+            return n;
+        }
+        if (!load_block(reader)) {
+            return 0;  // EOF
+        }
     }
+}
 
-    // 빈 줄 처리
-    if (strlen(line) == 0) {
-        return disk_reader_read_customer(reader, record);
+// 현재 블록이 소진되었으면 다음 블록 로드 (EOF면 0 반환)
+static int ensure_block(DiskReader *reader) {
+    if (reader->current_record < reader->records_in_buffer) {
+        return 1;
     }
+    return load_block(reader);
+}
 
-    // ========================================
-    // Customer 레코드 파싱 (TPC-H 스키마)
-    // Format: CUSTKEY|NAME|ADDRESS|NATIONKEY|PHONE|ACCTBAL|MKTSEGMENT|COMMENT
-    // ========================================
-    char *saveptr;
-    char *token;
+// 필드 파싱 도우미
+#define MAX_FIELDS 10
+#define FIELD_BEGIN(i) (block + ((i) == 0 ? start : ends[(i) - 1] + 1))
+#define FIELD_END(i) (block + ends[(i)])
 
+static inline long parse_long(const char *p, const char *end) {
+    long sign = 1, value = 0;
+    if (p < end && *p == '-') {
+        sign = -1;
+        p++;
+    }
+    while (p < end && *p >= '0' && *p <= '9') {
+        value = value * 10 + (*p++ - '0');
+    }
+    return sign * value;
+}
+
+// 최대 max_len 바이트까지 복사 후 NUL 종료
+static inline void copy_field(char *dst, int max_len, const char *p, const char *end) {
+    size_t len = end - p;
+    if (len > (size_t)max_len) {
+        len = max_len;
+    }
+    memcpy(dst, p, len);
+    dst[len] = '\0';
+}
+
+// ========================================
+// 4. Customer 레코드 읽기 및 파싱
+// ========================================
+
+// ========================================
+// Customer 레코드 파싱 (TPC-H 스키마)
+// Format: CUSTKEY|NAME|ADDRESS|NATIONKEY|PHONE|ACCTBAL|MKTSEGMENT|COMMENT
+// ========================================
+static inline void parse_customer(const char *block, const uint32_t *ends, int n,
+                                  uint32_t start, unsigned cols, CustomerRecord *record) {
     // C_CUSTKEY (고객 키)
-    token = strtok_r(line, "|", &saveptr);
-    if (token) record->custkey = atol(token);
+    if (cols & CUST_COL_CUSTKEY) record->custkey = parse_long(FIELD_BEGIN(0), FIELD_END(0));
 
     // C_NAME (고객 이름)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) {
-        strncpy(record->name, token, 25);
-        record->name[25] = '\0';
-    }
+    if (n > 1 && (cols & CUST_COL_NAME)) copy_field(record->name, 25, FIELD_BEGIN(1), FIELD_END(1));
 
     // C_ADDRESS (주소)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) {
-        strncpy(record->address, token, 40);
-        record->address[40] = '\0';
-    }
+    if (n > 2 && (cols & CUST_COL_ADDRESS)) copy_field(record->address, 40, FIELD_BEGIN(2), FIELD_END(2));
 
     // C_NATIONKEY (국가 키)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) record->nationkey = atol(token);
+    if (n > 3 && (cols & CUST_COL_NATIONKEY)) record->nationkey = parse_long(FIELD_BEGIN(3), FIELD_END(3));
 
     // C_PHONE (전화번호)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) {
-        strncpy(record->phone, token, 15);
-        record->phone[15] = '\0';
-    }
+    if (n > 4 && (cols & CUST_COL_PHONE)) copy_field(record->phone, 15, FIELD_BEGIN(4), FIELD_END(4));
 
     // C_ACCTBAL (계좌 잔액)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) record->acctbal = strtod(token, NULL);
+    if (n > 5 && (cols & CUST_COL_ACCTBAL)) record->acctbal = decimal_parse(FIELD_BEGIN(5), FIELD_END(5));
 
     // C_MKTSEGMENT (시장 세그먼트)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) {
-        strncpy(record->mktsegment, token, 10);
-        record->mktsegment[10] = '\0';
-    }
+    if (n > 6 && (cols & CUST_COL_MKTSEGMENT)) copy_field(record->mktsegment, 10, FIELD_BEGIN(6), FIELD_END(6));
 
     // C_COMMENT (코멘트)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) {
-        strncpy(record->comment, token, 117);
-        record->comment[117] = '\0';
+    if (n > 7 && (cols & CUST_COL_COMMENT)) copy_field(record->comment, 117, FIELD_BEGIN(7), FIELD_END(7));
+}
+
+int disk_reader_read_customer(DiskReader *reader, CustomerRecord *record) {
+    uint32_t ends[MAX_FIELDS];
+    uint32_t start;
+
+    // 컬럼 캐시 모드: 파싱 없이 컬럼 파일에서 복원
+    if (reader->mode == DISK_READER_MODE_COLUMNAR) {
+        if (!ensure_block(reader)) {
+            return 0;  // EOF
+        }
+        column_cache_read_customer(reader->cache, reader->block_row + reader->current_record++,
+                                   reader->columns, record);
+        reader->stats.records++;
+        return 1;
+    }
+
+    // 블록 버퍼에서 한 레코드의 필드 경계 찾기
+    int n = scan_record(reader, ends, MAX_FIELDS, &start);
+    if (n == 0) {
+        return 0;  // EOF
     }
 
+    parse_customer(reader->block, ends, n, start, reader->columns, record);
+    reader->stats.records++;
     return 1;
 }
 
@@ -186,91 +913,475 @@ int disk_reader_read_customer(DiskReader *reader, CustomerRecord *record) {
 // 5. Order 레코드 읽기 및 파싱
 // ========================================
 
+// ========================================
+// Order 레코드 파싱 (TPC-H 스키마)
+// Format: ORDERKEY|CUSTKEY|ORDERSTATUS|TOTALPRICE|ORDERDATE|ORDERPRIORITY|CLERK|SHIPPRIORITY|COMMENT
+// ========================================
+static inline void parse_order(const char *block, const uint32_t *ends, int n,
+                               uint32_t start, unsigned cols, OrderRecord *record) {
+    // O_ORDERKEY (주문 키)
+    if (cols & ORDER_COL_ORDERKEY) record->orderkey = parse_long(FIELD_BEGIN(0), FIELD_END(0));
+
+    // O_CUSTKEY (고객 키 - 조인 키)
+    if (n > 1 && (cols & ORDER_COL_CUSTKEY)) record->custkey = parse_long(FIELD_BEGIN(1), FIELD_END(1));
+
+    // O_ORDERSTATUS (주문 상태)
+    if (n > 2 && (cols & ORDER_COL_ORDERSTATUS)) record->orderstatus = *FIELD_BEGIN(2);
+
+    // O_TOTALPRICE (총 가격)
+    if (n > 3 && (cols & ORDER_COL_TOTALPRICE)) record->totalprice = decimal_parse(FIELD_BEGIN(3), FIELD_END(3));
+
+    // O_ORDERDATE (주문 날짜)
+    if (n > 4 && (cols & ORDER_COL_ORDERDATE)) copy_field(record->orderdate, 10, FIELD_BEGIN(4), FIELD_END(4));
+
+    // O_ORDERPRIORITY (주문 우선순위)
+    if (n > 5 && (cols & ORDER_COL_ORDERPRIORITY)) copy_field(record->orderpriority, 15, FIELD_BEGIN(5), FIELD_END(5));
+
+    // O_CLERK (담당 직원)
+    if (n > 6 && (cols & ORDER_COL_CLERK)) copy_field(record->clerk, 15, FIELD_BEGIN(6), FIELD_END(6));
+
+    // O_SHIPPRIORITY (배송 우선순위)
+    if (n > 7 && (cols & ORDER_COL_SHIPPRIORITY)) record->shippriority = parse_long(FIELD_BEGIN(7), FIELD_END(7));
+
+    // O_COMMENT (코멘트)
+    if (n > 8 && (cols & ORDER_COL_COMMENT)) copy_field(record->comment, 79, FIELD_BEGIN(8), FIELD_END(8));
+}
+
 int disk_reader_read_order(DiskReader *reader, OrderRecord *record) {
-    char line[512];
+    uint32_t ends[MAX_FIELDS];
+    uint32_t start;
+
+    // 컬럼 캐시 모드: 파싱 없이 컬럼 파일에서 복원
+    if (reader->mode == DISK_READER_MODE_COLUMNAR) {
+        if (!ensure_block(reader)) {
+            return 0;  // EOF
+        }
+        column_cache_read_order(reader->cache, reader->block_row + reader->current_record++,
+                                reader->columns, record);
+        reader->stats.records++;
+        return 1;
+    }
 
-    // 블록 버퍼에서 한 줄 읽기
-    if (!read_line(reader, line, sizeof(line))) {
+    // 블록 버퍼에서 한 레코드의 필드 경계 찾기
+    int n = scan_record(reader, ends, MAX_FIELDS, &start);
+    if (n == 0) {
         return 0;  // EOF
     }
 
-    // 빈 줄 처리
-    if (strlen(line) == 0) {
-        return disk_reader_read_order(reader, record);
+    parse_order(reader->block, ends, n, start, reader->columns, record);
+    reader->stats.records++;
+    return 1;
+}
+
+// ========================================
+// 5-1. 블록 단위 일괄 읽기 (Batch API)
+// - 현재 I/O 블록에 남은 레코드를 최대 max개까지 한 번에 파싱
+// - 블록 경계는 리더별로 결정되므로 다른 스레드의 I/O와 무관하게 일정함
+// - 반환값: 1 = *n개 읽음, 0 = EOF (*n == 0)
+// - 키 범위/날짜 필터가 있으면 해당 컬럼을 먼저 파싱해 조건 밖 행은 배치에 넣지 않음
+// - Order 리더는 행을 읽기 전에 존 맵으로 조건과 겹칠 수 없는 청크를 건너뜀
+// ========================================
+
+// 일괄 읽기 레코드별 줄 시작 위치 배열 확보 (지연 materialize용)
+static int reserve_batch(DiskReader *reader, int max) {
+    if (max <= reader->batch_capacity) {
+        return 1;
+    }
+    uint32_t *lines = (uint32_t *)realloc(reader->batch_lines, sizeof(uint32_t) * max);
+    if (!lines) {
+        fprintf(stderr, "일괄 읽기 배열 할당 실패\n");
+        return 0;
     }
+    reader->batch_lines = lines;
+    reader->batch_capacity = max;
+    return 1;
+}
 
-    // ========================================
-    // Order 레코드 파싱 (TPC-H 스키마)
-    // Format: ORDERKEY|CUSTKEY|ORDERSTATUS|TOTALPRICE|ORDERDATE|ORDERPRIORITY|CLERK|SHIPPRIORITY|COMMENT
-    // ========================================
-    char *saveptr;
-    char *token;
+// 일괄 읽기 한 번의 파싱 시간 기록 (전체 소요 시간에서 블록 읽기 시간을 뺀 값)
+static inline void add_parse_stats(DiskReader *reader, long t0, long read_ns0, int count) {
+    reader->stats.parse_ns += (now_ns() - t0) - (reader->stats.read_ns - read_ns0);
+    reader->stats.records += count;
+}
 
-    // O_ORDERKEY (주문 키)
-    token = strtok_r(line, "|", &saveptr);
-    if (token) record->orderkey = atol(token);
+static inline int key_in_filter(const DiskReader *reader, long key) {
+    return key >= reader->key_min && key <= reader->key_max;
+}
 
-    // O_CUSTKEY (고객 키 - 조인 키)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) record->custkey = atol(token);
+static inline int date_in_filter(const DiskReader *reader, int date) {
+    return date >= reader->date_min && date <= reader->date_max;
+}
 
-    // O_ORDERSTATUS (주문 상태)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) record->orderstatus = token[0];
+// 조건이 바뀌면 존 맵 후보 청크를 다시 판정
+void disk_reader_set_key_filter(DiskReader *reader, long min_key, long max_key) {
+    reader->key_filter = 1;
+    reader->key_min = min_key;
+    reader->key_max = max_key;
+    reader->zone_next = 0;
+}
 
-    // O_TOTALPRICE (총 가격)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) record->totalprice = strtod(token, NULL);
+void disk_reader_clear_key_filter(DiskReader *reader) {
+    reader->key_filter = 0;
+    reader->zone_next = 0;
+}
 
-    // O_ORDERDATE (주문 날짜)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) {
-        strncpy(record->orderdate, token, 10);
-        record->orderdate[10] = '\0';
+void disk_reader_set_date_filter(DiskReader *reader, int min_date, int max_date) {
+    reader->date_filter = 1;
+    reader->date_min = min_date;
+    reader->date_max = max_date;
+    reader->zone_next = 0;
+}
+
+void disk_reader_clear_date_filter(DiskReader *reader) {
+    reader->date_filter = 0;
+    reader->zone_next = 0;
+}
+
+int disk_reader_read_customers_batch(DiskReader *reader, CustomerRecord *out, int max, int *n) {
+    uint32_t ends[MAX_FIELDS];
+    uint32_t start;
+    int count = 0;
+    long t0 = now_ns();
+    long read_ns0 = reader->stats.read_ns;
+
+    if (!reserve_batch(reader, max)) {
+        *n = 0;
+        return 0;
     }
 
-    // O_ORDERPRIORITY (주문 우선순위)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) {
-        strncpy(record->orderpriority, token, 15);
-        record->orderpriority[15] = '\0';
+    // 블록 끝이 빈 줄뿐이었다면 다음 블록으로 넘어감
+    while (count == 0 && max > 0 && ensure_block(reader)) {
+        if (reader->mode == DISK_READER_MODE_COLUMNAR) {
+            while (count < max && reader->current_record < reader->records_in_buffer) {
+                long row = reader->block_row + reader->current_record;
+                if (reader->key_filter) {
+                    column_cache_read_customer(reader->cache, row, CUST_COL_CUSTKEY, &out[count]);
+                    if (!key_in_filter(reader, out[count].custkey)) {
+                        reader->current_record++;
+                        reader->stats.filtered++;
+                        continue;
+                    }
+                }
+                reader->batch_lines[count] = reader->current_record++;
+                column_cache_read_customer(reader->cache, row, reader->columns, &out[count++]);
+            }
+            continue;
+        }
+
+        int fields;
+        while (count < max && (fields = scan_record_in_block(reader, ends, MAX_FIELDS, &start)) > 0) {
+            if (reader->key_filter) {
+                // 조인 키만 먼저 파싱: 범위 밖이면 나머지 컬럼은 파싱하지 않음
+                const char *block = reader->block;
+                long key = parse_long(FIELD_BEGIN(0), FIELD_END(0));
+                if (!key_in_filter(reader, key)) {
+                    reader->stats.filtered++;
+                    continue;
+                }
+                out[count].custkey = key;
+                reader->batch_lines[count] = start;
+                parse_customer(reader->block, ends, fields, start, reader->columns & ~CUST_COL_CUSTKEY, &out[count++]);
+                continue;
+            }
+            reader->batch_lines[count] = start;
+            parse_customer(reader->block, ends, fields, start, reader->columns, &out[count++]);
+        }
     }
 
-    // O_CLERK (담당 직원)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) {
-        strncpy(record->clerk, token, 15);
-        record->clerk[15] = '\0';
+    add_parse_stats(reader, t0, read_ns0, count);
+    *n = count;
+    return count > 0;
+}
+
+int disk_reader_read_orders_batch(DiskReader *reader, OrderRecord *out, int max, int *n) {
+    uint32_t ends[MAX_FIELDS];
+    uint32_t start;
+    int count = 0;
+    long t0 = now_ns();
+    long read_ns0 = reader->stats.read_ns;
+
+    if (!reserve_batch(reader, max)) {
+        *n = 0;
+        return 0;
     }
 
-    // O_SHIPPRIORITY (배송 우선순위)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) record->shippriority = atol(token);
+    // 블록 끝이 빈 줄뿐이었다면 다음 블록으로 넘어감
+    while (count == 0 && max > 0 && ensure_block(reader)) {
+        if (reader->mode == DISK_READER_MODE_COLUMNAR) {
+            while (count < max) {
+                zone_check(reader);
+                if (reader->current_record >= reader->records_in_buffer) {
+                    break;
+                }
+                long row = reader->block_row + reader->current_record;
+                if (reader->key_filter) {
+                    column_cache_read_order(reader->cache, row, ORDER_COL_CUSTKEY, &out[count]);
+                    if (!key_in_filter(reader, out[count].custkey)) {
+                        reader->current_record++;
+                        reader->stats.filtered++;
+                        continue;
+                    }
+                }
+                if (reader->date_filter) {
+                    const char *date = out[count].orderdate;
+                    column_cache_read_order(reader->cache, row, ORDER_COL_ORDERDATE, &out[count]);
+                    if (!date_in_filter(reader, zone_map_parse_date(date, date + strlen(date)))) {
+                        reader->current_record++;
+                        reader->stats.filtered++;
+                        continue;
+                    }
+                }
+                reader->batch_lines[count] = reader->current_record++;
+                column_cache_read_order(reader->cache, row, reader->columns, &out[count++]);
+            }
+            continue;
+        }
 
-    // O_COMMENT (코멘트)
-    token = strtok_r(NULL, "|", &saveptr);
-    if (token) {
-        strncpy(record->comment, token, 79);
-        record->comment[79] = '\0';
+        int fields;
+        while (count < max) {
+            zone_check(reader);
+            if ((fields = scan_record_in_block(reader, ends, MAX_FIELDS, &start)) <= 0) {
+                break;
+            }
+            if (reader->key_filter || reader->date_filter) {
+                // 조인 키(O_CUSTKEY)/O_ORDERDATE만 먼저 파싱: 조건 밖이면 나머지 컬럼은 파싱하지 않음
+                const char *block = reader->block;
+                unsigned parsed = 0;
+                if (reader->key_filter) {
+                    long key = fields > 1 ? parse_long(FIELD_BEGIN(1), FIELD_END(1)) : 0;
+                    if (!key_in_filter(reader, key)) {
+                        reader->stats.filtered++;
+                        continue;
+                    }
+                    out[count].custkey = key;
+                    parsed = ORDER_COL_CUSTKEY;
+                }
+                if (reader->date_filter) {
+                    int date = fields > 4 ? zone_map_parse_date(FIELD_BEGIN(4), FIELD_END(4)) : 0;
+                    if (!date_in_filter(reader, date)) {
+                        reader->stats.filtered++;
+                        continue;
+                    }
+                }
+                reader->batch_lines[count] = start;
+                parse_order(reader->block, ends, fields, start, reader->columns & ~parsed, &out[count++]);
+                continue;
+            }
+            reader->batch_lines[count] = start;
+            parse_order(reader->block, ends, fields, start, reader->columns, &out[count++]);
+        }
+    }
+
+    add_parse_stats(reader, t0, read_ns0, count);
+    *n = count;
+    return count > 0;
+}
+
+// ========================================
+// 5-2. 컬럼 선택 (Projection Pushdown) 및 지연 materialize
+// - 필요한 컬럼만 파싱하도록 마스크 지정 (예: 프로브 스캔은 O_CUSTKEY만)
+// - 매칭된 행만 직전 일괄 읽기의 줄 위치에서 전체 컬럼을 다시 파싱
+// ========================================
+
+void disk_reader_set_columns(DiskReader *reader, unsigned columns) {
+    reader->columns = columns;
+}
+
+#define LINE_MAX_BYTES 512  // 지연 파싱 시 한 줄로 간주하는 최대 길이
+#define LOCATE_WINDOW (64 * 1024)  // 위치 기반 읽기 창 크기 (DIRECT_IO_ALIGN의 배수)
+
+// block의 start 위치에서 시작하는 한 줄의 필드 끝 위치 수집 (limit = 데이터 끝)
+static int split_line(const char *block, uint32_t start, size_t limit, uint32_t *ends, int max_fields) {
+    uint32_t pos[LINE_MAX_BYTES];
+    size_t end = start + LINE_MAX_BYTES;
+    if (end > limit) {
+        end = limit;
+    }
+
+    size_t count = delim_scan(block, start, end, pos);
+    int n = 0;
+    for (size_t i = 0; i < count && n < max_fields; i++) {
+        ends[n++] = pos[i];
+        if (block[pos[i]] == '\n') {
+            return n;
+        }
+    }
+    if (n < max_fields) {
+        ends[n++] = end;  // 개행 없이 끝난 마지막 줄
+    }
+    return n;
+}
+
+int disk_reader_materialize_order(DiskReader *reader, int batch_idx, OrderRecord *record) {
+    uint32_t ends[MAX_FIELDS];
+    uint32_t start = reader->batch_lines[batch_idx];
+
+    if (reader->mode == DISK_READER_MODE_COLUMNAR) {
+        column_cache_read_order(reader->cache, reader->block_row + start, ORDER_COL_ALL, record);
+        return 1;
+    }
+
+    int n = split_line(reader->block, start, reader->records_in_buffer, ends, MAX_FIELDS);
+    parse_order(reader->block, ends, n, start, ORDER_COL_ALL, record);
+    return 1;
+}
+
+long disk_reader_order_locator(const DiskReader *reader, int batch_idx) {
+    // 컬럼 캐시: 행 번호, 텍스트: 파일 기준 바이트 위치
+    return block_position(reader) + reader->batch_lines[batch_idx];
+}
+
+int disk_reader_read_order_at(DiskReader *reader, long locator, OrderRecord *record) {
+    uint32_t ends[MAX_FIELDS];
+
+    if (reader->mode == DISK_READER_MODE_COLUMNAR) {
+        column_cache_read_order(reader->cache, locator, ORDER_COL_ALL, record);
+        return 1;
     }
 
+    // 줄 시작부터 최대 LINE_MAX_BYTES 구간 확보
+    const char *line;
+    size_t len;
+    if (reader->mode == DISK_READER_MODE_MMAP) {
+        line = reader->map + locator;
+        len = reader->file_size - locator;
+    } else {
+        // fread/O_DIRECT: 정렬된 위치부터 LOCATE_WINDOW를 pread (O_DIRECT 정렬 조건 충족)
+        // 위치가 오름차순으로 들어오는 경우가 많으므로 직전 창에 줄 전체가 있으면 재사용
+        long window_end = reader->locate_offset + reader->locate_size;
+        if (locator < reader->locate_offset ||
+            (locator + LINE_MAX_BYTES > window_end && window_end < reader->file_size)) {
+            if (!reader->locate_buffer) {
+                reader->locate_buffer = alloc_block_buffer(LOCATE_WINDOW);
+                if (!reader->locate_buffer) {
+                    return 0;
+                }
+            }
+            int fd = reader->direct_fd >= 0 ? reader->direct_fd : fileno(reader->file);
+            long aligned = locator & ~(long)(DIRECT_IO_ALIGN - 1);
+            ssize_t got = pread(fd, reader->locate_buffer, LOCATE_WINDOW, aligned);
+            reader->locate_offset = aligned;
+            reader->locate_size = got > 0 ? got : 0;
+            window_end = aligned + reader->locate_size;
+        }
+        if (locator >= window_end) {
+            return 0;
+        }
+        line = reader->locate_buffer + (locator - reader->locate_offset);
+        len = window_end - locator;
+    }
+    if (len > LINE_MAX_BYTES) {
+        len = LINE_MAX_BYTES;
+    }
+
+    int n = split_line(line, 0, len, ends, MAX_FIELDS);
+    parse_order(line, ends, n, 0, ORDER_COL_ALL, record);
     return 1;
 }
 
+// ========================================
+// 5-3. 담당 범위 지정 (Byte-range Partitioning)
+// - 파일을 바이트 기준으로 num_parts등분하고 각 경계를 다음 줄 시작으로 맞춤
+// - 스레드는 줄 수를 미리 세거나 앞부분을 파싱해 건너뛸 필요 없이 바로 이동
+// ========================================
+
+#define LINE_PROBE_SIZE (64 * 1024)
+
+// offset 이후 첫 줄의 시작 위치 (offset이 줄 시작이면 그대로)
+static long find_line_start(DiskReader *reader, long offset) {
+    if (offset <= 0) {
+        return 0;
+    }
+    if (offset >= reader->file_size) {
+        return reader->file_size;
+    }
+
+    // offset - 1 위치부터 처음 나오는 개행 다음이 줄 시작
+    if (reader->mode == DISK_READER_MODE_MMAP) {
+        const char *nl = memchr(reader->map + offset - 1, '\n', reader->file_size - (offset - 1));
+        return nl ? (long)(nl - reader->map) + 1 : reader->file_size;
+    }
+
+    // fread/O_DIRECT: 정렬된 위치부터 pread로 조금씩 읽으며 탐색
+    int fd = reader->direct_fd >= 0 ? reader->direct_fd : fileno(reader->file);
+    char *chunk = alloc_block_buffer(LINE_PROBE_SIZE);
+    long pos = (offset - 1) & ~(long)(DIRECT_IO_ALIGN - 1);
+    long result = reader->file_size;
+
+    while (chunk && pos < reader->file_size) {
+        ssize_t got = pread(fd, chunk, LINE_PROBE_SIZE, pos);
+        if (got <= 0) {
+            break;
+        }
+        long from = offset - 1 > pos ? offset - 1 - pos : 0;
+        if (from < got) {
+            const char *nl = memchr(chunk + from, '\n', got - from);
+            if (nl) {
+                result = pos + (nl - chunk) + 1;
+                break;
+            }
+        }
+        pos += got;
+    }
+
+    free(chunk);
+    return result;
+}
+
+void disk_reader_set_partition(DiskReader *reader, int part, int num_parts) {
+    long total = reader->mode == DISK_READER_MODE_COLUMNAR ? reader->cache->rows : reader->file_size;
+    long begin = total * part / num_parts;
+    long end = total * (part + 1) / num_parts;
+
+    // 텍스트 모드는 경계를 줄 시작으로 맞춤 (컬럼 캐시 모드는 행 번호 그대로)
+    if (reader->mode != DISK_READER_MODE_COLUMNAR) {
+        begin = find_line_start(reader, begin);
+        end = find_line_start(reader, end);
+    }
+
+    reader->range_start = begin;
+    reader->range_end = end;
+    disk_reader_reset(reader);
+}
+
 // ========================================
 // 6. 파일 포인터 리셋 (재스캔용)
 // ========================================
 
 void disk_reader_reset(DiskReader *reader) {
-    // 파일 포인터를 처음으로 되돌림 (Order 재스캔용)
-    fseek(reader->file, 0, SEEK_SET);
+    // 읽기 위치를 처음으로 되돌림 (Order 재스캔, 담당 범위 지정 후 이동)
+    // mmap 모드는 포인터만 되감으면 되므로 버퍼 초기화가 필요 없음
+    // 담당 범위(disk_reader_set_partition)가 있으면 범위 시작으로 되돌림
+    if (reader->mode == DISK_READER_MODE_COLUMNAR) {
+        reader->row_pos = reader->range_start;
+    } else if (reader->mode == DISK_READER_MODE_MMAP) {
+        reader->map_offset = reader->range_start;
+    } else {
+        prefetch_wait(reader);  // 진행 중인 선읽기 결과는 버림
+        if (reader->mode == DISK_READER_MODE_DIRECT) {
+            // O_DIRECT는 정렬된 위치부터 읽고 앞부분은 read_next_block에서 버림
+            reader->direct_offset = reader->range_start & ~(long)(DIRECT_IO_ALIGN - 1);
+            reader->data_offset = reader->direct_offset;
+        } else {
+            fseek(reader->file, reader->range_start, SEEK_SET);
+            reader->data_offset = reader->range_start;
+        }
+        reader->read_from = reader->range_start;
+    }
 
     // 상태 초기화
     reader->buffer_valid = 0;
     reader->current_block = 0;
     reader->records_in_buffer = 0;
     reader->current_record = 0;
-    memset(reader->buffer, 0, reader->buffer_size);
+    reader->carry_size = 0;
+    reader->delim_count = 0;
+    reader->delim_next = 0;
+    reader->scan_pos = 0;
+    reader->zone_next = 0;  // 존 맵 후보 청크는 새 위치에서 다시 판정
+
+    if (reader->prefetch) {
+        prefetch_start(reader);  // 처음 블록부터 다시 선읽기
+    }
 }
 
 // ========================================
@@ -279,24 +1390,66 @@ void disk_reader_reset(DiskReader *reader) {
 
 void disk_reader_close(DiskReader *reader) {
     if (reader) {
+        prefetch_destroy(reader);  // 선읽기 스레드 종료 (파일 닫기 전)
         if (reader->file) {
             fclose(reader->file);  // 파일 닫기
         }
-        if (reader->buffer) {
-            free(reader->buffer);  // 버퍼 메모리 해제
+        if (reader->direct_fd >= 0) {
+            close(reader->direct_fd);
+        }
+        free(reader->buffer);  // 버퍼 메모리 해제
+        free(reader->spare_buffer);
+        if (reader->map) {
+            munmap((void *)reader->map, reader->map_size);  // 매핑 해제
         }
+        column_cache_close(reader->cache);  // 컬럼 캐시 매핑 해제
+        zone_map_close(reader->zone_map);
+        free(reader->delims);
+        free(reader->batch_lines);
+        free(reader->locate_buffer);
         free(reader);  // 구조체 메모리 해제
     }
 }
 
 // ========================================
-// 8. I/O 카운트 조회 및 관리
+// 8. I/O/파싱 통계 조회 및 병합
+// - 리더마다 독립 카운터를 두고 스레드 종료 시 한 번만 합산
 // ========================================
 
-long disk_reader_get_io_count(void) {
-    return total_io_count;
+void disk_reader_get_stats(const DiskReader *reader, DiskReaderStats *stats) {
+    *stats = reader->stats;
 }
 
-void disk_reader_reset_io_count(void) {
-    total_io_count = 0;
+void disk_reader_stats_merge(DiskReaderStats *total, const DiskReaderStats *stats) {
+    total->blocks += stats->blocks;
+    total->bytes += stats->bytes;
+    total->converted_bytes += stats->converted_bytes;
+    total->read_ns += stats->read_ns;
+    total->parse_ns += stats->parse_ns;
+    total->records += stats->records;
+    total->filtered += stats->filtered;
+    total->zone_chunks += stats->zone_chunks;
+    total->zone_bytes += stats->zone_bytes;
+}
+
+void disk_reader_stats_print(const char *label, const DiskReaderStats *stats) {
+    double read_sec = stats->read_ns / 1e9;
+    double parse_sec = stats->parse_ns / 1e9;
+    double mb = stats->bytes / (1024.0 * 1024.0);
+
+    // 컬럼 캐시 모드는 실제 캐시 읽기량이 아니라 원본 텍스트 기준 환산값임을 표시
+    const char *unit = stats->converted_bytes == 0 ? "MB"
+                     : stats->converted_bytes == stats->bytes ? "MB (원본 환산)" : "MB (일부 원본 환산)";
+
+    printf("%s블록 %ld개, %.1f %s, 읽기 %.3f초 (%.0f MB/s), 파싱 %.3f초, 레코드 %ld개",
+           label, stats->blocks, mb, unit, read_sec, read_sec > 0 ? mb / read_sec : 0.0,
+           parse_sec, stats->records);
+    if (stats->filtered > 0) {
+        printf(" (키 범위/날짜 필터 제외 %ld개)", stats->filtered);
+    }
+    if (stats->zone_chunks > 0) {
+        printf(" (존 맵으로 청크 %ld개, %.1f MB 건너뜀)",
+               stats->zone_chunks, stats->zone_bytes / (1024.0 * 1024.0));
+    }
+    printf("\n");
 }
@@ -2,16 +2,40 @@
 #define DISK_READER_H
 
 #include <stdio.h>
+#include <stdint.h>
+#include "decimal.h"
 
 #define RECORDS_PER_BLOCK 100
 
+// 컬럼 마스크 (Projection Pushdown: 지정한 컬럼만 파싱)
+#define CUST_COL_CUSTKEY        (1u << 0)
+#define CUST_COL_NAME           (1u << 1)
+#define CUST_COL_ADDRESS        (1u << 2)
+#define CUST_COL_NATIONKEY      (1u << 3)
+#define CUST_COL_PHONE          (1u << 4)
+#define CUST_COL_ACCTBAL        (1u << 5)
+#define CUST_COL_MKTSEGMENT     (1u << 6)
+#define CUST_COL_COMMENT        (1u << 7)
+#define CUST_COL_ALL            0xFFu
+
+#define ORDER_COL_ORDERKEY      (1u << 0)
+#define ORDER_COL_CUSTKEY       (1u << 1)
+#define ORDER_COL_ORDERSTATUS   (1u << 2)
+#define ORDER_COL_TOTALPRICE    (1u << 3)
+#define ORDER_COL_ORDERDATE     (1u << 4)
+#define ORDER_COL_ORDERPRIORITY (1u << 5)
+#define ORDER_COL_CLERK         (1u << 6)
+#define ORDER_COL_SHIPPRIORITY  (1u << 7)
+#define ORDER_COL_COMMENT       (1u << 8)
+#define ORDER_COL_ALL           0x1FFu
+
 typedef struct {
     long custkey;           // C_CUSTKEY
     char name[26];          // C_NAME
     char address[41];       // C_ADDRESS
     long nationkey;         // C_NATIONKEY
     char phone[16];         // C_PHONE
-    double acctbal;         // C_ACCTBAL
+    Decimal acctbal;        // C_ACCTBAL (센트 단위)
     char mktsegment[11];    // C_MKTSEGMENT
     char comment[118];      // C_COMMENT
 } CustomerRecord;
@@ -20,7 +44,7 @@ typedef struct {
     long orderkey;          // O_ORDERKEY
     long custkey;           // O_CUSTKEY
     char orderstatus;       // O_ORDERSTATUS (single char: O, F, P)
-    double totalprice;      // O_TOTALPRICE
+    Decimal totalprice;     // O_TOTALPRICE (센트 단위)
     char orderdate[11];     // O_ORDERDATE (YYYY-MM-DD)
     char orderpriority[16]; // O_ORDERPRIORITY
     char clerk[16];         // O_CLERK
@@ -28,24 +52,121 @@ typedef struct {
     char comment[80];       // O_COMMENT
 } OrderRecord;
 
+// 입력 파일 접근 방식
+typedef enum {
+    DISK_READER_MODE_FREAD = 0,  // fread로 malloc 버퍼에 복사 (기존 방식)
+    DISK_READER_MODE_MMAP = 1,   // 읽기 전용 mmap (페이지 캐시 공유, 리더별 복사 없음)
+    DISK_READER_MODE_COLUMNAR = 2, // 바이너리 컬럼 캐시 (column_cache.h, 파싱 없음)
+    DISK_READER_MODE_DIRECT = 3    // O_DIRECT + 정렬 버퍼 (페이지 캐시 우회)
+} DiskReaderMode;
+
+// O_DIRECT 읽기의 버퍼 주소/파일 오프셋/길이 정렬 단위
+#define DIRECT_IO_ALIGN 4096
+
+// 리더별 I/O/파싱 통계 (스레드마다 독립적으로 누적 후 병합)
+typedef struct {
+    long blocks;            // 읽은 블록 수 (I/O 횟수)
+    long bytes;             // 읽은 바이트 수 (컬럼 캐시 모드는 원본 기준 환산값)
+    long converted_bytes;   // bytes 중 컬럼 캐시 행 수에서 환산한 부분 (출력 시 표시용)
+    long read_ns;           // 블록 읽기 시간 (시스템 콜, 선읽기 대기, 페이지 폴트)
+    long parse_ns;          // 일괄 읽기 파싱 시간 (블록 읽기 시간 제외)
+    long records;           // 생성한 레코드 수
+    long filtered;          // 키 범위/날짜 필터로 버린 레코드 수 (records에 포함되지 않음)
+    long zone_chunks;       // 존 맵으로 건너뛴 청크 수
+    long zone_bytes;        // 건너뛴 청크의 원본 바이트 수
+} DiskReaderStats;
+
+struct ColumnCache;
+struct ZoneMap;
+typedef struct DiskPrefetch DiskPrefetch;
+
 typedef struct {
+    DiskReaderStats stats;
     FILE *file;
-    char *buffer;
+    long file_size;
+    long range_start;       // 담당 범위 시작 (바이트, 줄 경계 / 컬럼 캐시: 행 번호)
+    long range_end;         // 담당 범위 끝 (기본값: 파일 끝)
+    long data_offset;       // fread/O_DIRECT 모드: 다음 선읽기 데이터의 파일 위치
+    long read_from;         // fread/O_DIRECT 모드: 이 위치 앞의 선읽기 데이터는 버림 (정렬 읽기용)
+    long block_offset;      // fread/O_DIRECT 모드: 현재 블록 시작의 파일 위치
+    char *locate_buffer;    // 위치 기반 읽기(disk_reader_read_order_at)용 정렬 버퍼
+    long locate_offset;     // locate_buffer에 담긴 창의 파일 위치
+    long locate_size;       // locate_buffer에 담긴 바이트 수
+    int direct_fd;          // O_DIRECT 모드: 파일 디스크립터 (그 외 -1)
+    long direct_offset;     // O_DIRECT 모드: 다음 읽기 위치 (정렬됨)
+    char *buffer;           // fread/O_DIRECT 모드 전용 버퍼 (mmap 모드에서는 NULL)
+    char *spare_buffer;     // fread/O_DIRECT 모드: 다음 블록을 미리 읽는 여분 버퍼
+    DiskPrefetch *prefetch; // fread/O_DIRECT 모드: 선읽기 스레드 상태
+    const char *block;      // 현재 블록 데이터 (buffer 또는 매핑 내부를 가리킴)
+    DiskReaderMode mode;
+    const char *map;        // mmap 모드: 파일 전체 매핑
+    size_t map_size;
+    size_t map_offset;      // mmap 모드: 다음 블록 시작 위치
+    struct ColumnCache *cache;  // 컬럼 캐시 모드: 매핑된 컬럼 파일
+    long row_pos;           // 컬럼 캐시 모드: 다음 블록 시작 행
+    long block_row;         // 컬럼 캐시 모드: 현재 블록 시작 행
+    int rows_per_block;     // 컬럼 캐시 모드: 블록당 행 수 (원본 텍스트 block_size 환산)
     int buffer_size;
     int block_size;
     int buffer_valid;
     long current_block;
     long total_blocks;
-    int records_in_buffer;
-    int current_record;
+    int records_in_buffer;  // 현재 블록 길이 (바이트, 항상 줄 경계에서 끝남 / 컬럼 캐시: 행 수)
+    int current_record;     // 다음 레코드 시작 위치 (블록 내 오프셋 / 컬럼 캐시: 블록 내 행)
+    int carry_size;         // fread 모드: 다음 블록 앞에 붙일 미완성 줄 길이
+    uint32_t *delims;       // 스캔된 구분자 위치 (블록 내 오프셋, DELIM_SCAN_WINDOW개)
+    int delim_count;
+    int delim_next;
+    int scan_pos;           // 블록 내 구분자 스캔 완료 위치
+    unsigned columns;       // 파싱할 컬럼 마스크 (CUST_COL_* / ORDER_COL_*)
+    uint32_t *batch_lines;  // 직전 일괄 읽기 레코드별 줄 시작 위치
+    int batch_capacity;
+    int key_filter;         // 1이면 일괄 읽기에서 조인 키가 [key_min, key_max] 밖인 행을 버림
+    long key_min;
+    long key_max;
+    int date_filter;        // 1이면 일괄 읽기에서 O_ORDERDATE가 [date_min, date_max] 밖인 행을 버림
+    int date_min;           // YYYYMMDD
+    int date_max;
+    struct ZoneMap *zone_map;  // Order 리더: 유효한 <원본>.zonemap이 있으면 로드 (없으면 NULL)
+    long zone_next;         // 이 위치 전까지는 조건과 겹치는 청크 안 (0이면 다시 확인)
 } DiskReader;
 
 DiskReader* disk_reader_open(const char *filename, const char *type, int block_size);
+DiskReader* disk_reader_open_mode(const char *filename, const char *type, int block_size, DiskReaderMode mode);
+void disk_reader_set_default_mode(DiskReaderMode mode);
+DiskReaderMode disk_reader_get_default_mode(void);
+const char* disk_reader_mode_name(DiskReaderMode mode);
 int disk_reader_read_customer(DiskReader *reader, CustomerRecord *record);
 int disk_reader_read_order(DiskReader *reader, OrderRecord *record);
+// 현재 I/O 블록의 레코드를 최대 max개까지 일괄 읽기 (반환값 0 = EOF)
+int disk_reader_read_customers_batch(DiskReader *reader, CustomerRecord *out, int max, int *n);
+int disk_reader_read_orders_batch(DiskReader *reader, OrderRecord *out, int max, int *n);
+// 파싱할 컬럼 지정 (기본값: 전체) 및 직전 일괄 읽기의 batch_idx번째 행 전체 컬럼 파싱
+void disk_reader_set_columns(DiskReader *reader, unsigned columns);
+int disk_reader_materialize_order(DiskReader *reader, int batch_idx, OrderRecord *record);
+// 직전 일괄 읽기 batch_idx번째 행의 위치 (텍스트: 파일 바이트 위치, 컬럼 캐시: 행 번호)
+// 블록이 바뀐 뒤에도 disk_reader_read_order_at으로 해당 행 전체 컬럼을 다시 읽을 수 있음
+long disk_reader_order_locator(const DiskReader *reader, int batch_idx);
+int disk_reader_read_order_at(DiskReader *reader, long locator, OrderRecord *record);
+// 일괄 읽기 키 범위 필터 (Customer: C_CUSTKEY, Order: O_CUSTKEY)
+// 조인 키를 먼저 파싱해 범위 밖이면 나머지 컬럼을 파싱하지 않고 버림 (배치 인덱스는 남은 행 기준)
+void disk_reader_set_key_filter(DiskReader *reader, long min_key, long max_key);
+void disk_reader_clear_key_filter(DiskReader *reader);
+// 일괄 읽기 주문 날짜 조건 (Order 전용, YYYYMMDD 정수, 양 끝 포함)
+// default는 이후 disk_reader_open으로 여는 Order 리더에 적용 (컬럼 캐시/존 맵 생성에는 적용 안 함)
+// Order 리더는 키 범위/날짜 조건과 겹칠 수 없는 존 맵(zone_map.h) 청크를 건너뜀
+// (mmap/컬럼 캐시: 해당 구간을 아예 읽지 않음, fread/O_DIRECT: 다음 블록 읽기 위치를 옮김,
+//  모든 방식: 읽은 블록 안의 해당 구간은 파싱하지 않음)
+void disk_reader_set_date_filter(DiskReader *reader, int min_date, int max_date);
+void disk_reader_clear_date_filter(DiskReader *reader);
+void disk_reader_set_default_date_filter(int min_date, int max_date);
+// 파일을 num_parts개 줄 경계 범위로 나눠 part번째 범위만 읽도록 지정 (처음 위치로 이동)
+void disk_reader_set_partition(DiskReader *reader, int part, int num_parts);
 void disk_reader_reset(DiskReader *reader);
 void disk_reader_close(DiskReader *reader);
-long disk_reader_get_io_count(void);
-void disk_reader_reset_io_count(void);
+// 리더별 통계 조회, 누적 합산 및 한 줄 출력 (label은 줄 앞에 그대로 출력)
+void disk_reader_get_stats(const DiskReader *reader, DiskReaderStats *stats);
+void disk_reader_stats_merge(DiskReaderStats *total, const DiskReaderStats *stats);
+void disk_reader_stats_print(const char *label, const DiskReaderStats *stats);
 
 #endif
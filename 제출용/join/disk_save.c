@@ -94,24 +94,31 @@ int result_buffer_flush(ResultBuffer *buffer) {
     // 각 JOIN 결과를 파일에 기록 (TPC-H 포맷)
     // Format: Customer 컬럼들 | Order 컬럼들
     // ========================================
+    char acctbal[DECIMAL_STR_MAX];
+    char totalprice[DECIMAL_STR_MAX];
+
     for (long i = 0; i < buffer->count; i++) {
         JoinResult *result = &buffer->results[i];
 
-        fprintf(fp, "%ld|%s|%s|%ld|%s|%.2f|%s|%s|"           // Customer 필드
-                    "%ld|%c|%.2f|%s|%s|%s|%ld|%s\n",        // Order 필드
+        // 금액 필드는 센트 단위 정수를 직접 문자열로 변환 (%.2f 대체)
+        decimal_format(result->customer.acctbal, acctbal);
+        decimal_format(result->order.totalprice, totalprice);
+
+        fprintf(fp, "%ld|%s|%s|%ld|%s|%s|%s|%s|"             // Customer 필드
+                    "%ld|%c|%s|%s|%s|%s|%ld|%s\n",          // Order 필드
                 // Customer fields
                 result->customer.custkey,
                 result->customer.name,
                 result->customer.address,
                 result->customer.nationkey,
                 result->customer.phone,
-                result->customer.acctbal,
+                acctbal,
                 result->customer.mktsegment,
                 result->customer.comment,
                 // Order fields
                 result->order.orderkey,
                 result->order.orderstatus,
-                result->order.totalprice,
+                totalprice,
                 result->order.orderdate,
                 result->order.orderpriority,
                 result->order.clerk,
@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <string.h>
+#include "hash_table.h"
+
+// ========================================
+// 해시 테이블 모듈 (Hash Table Module)
+// - 선형 탐사: 충돌 시 다음 슬롯으로 이동, 빈 슬롯을 만나면 탐색 종료
+// - 삭제가 없으므로 묘비(tombstone) 처리 불필요
+// ========================================
+
+static double default_load_factor = HASH_TABLE_DEFAULT_LOAD_FACTOR;
+
+void hash_table_set_default_load_factor(double load_factor) {
+    if (load_factor < 0.05) {
+        load_factor = 0.05;
+    } else if (load_factor > 0.95) {
+        load_factor = 0.95;  // 탐사 종료용 빈 슬롯 확보
+    }
+    default_load_factor = load_factor;
+}
+
+double hash_table_get_default_load_factor(void) {
+    return default_load_factor;
+}
+
+// expected개를 목표 적재율 이하로 담는 2의 거듭제곱 슬롯 수
+static size_t capacity_for(size_t expected, double load_factor) {
+    size_t need = (size_t)(expected / load_factor) + 1;
+    size_t capacity = HASH_TABLE_MIN_CAPACITY;
+    while (capacity < need) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+size_t hash_table_arena_bytes(size_t expected) {
+    return arena_size_for(sizeof(HashTable)) +
+           arena_size_for(sizeof(HashSlot) * capacity_for(expected, default_load_factor));
+}
+
+HashTable* hash_table_create(Arena *arena, size_t expected) {
+    // 작은 블록은 작은 테이블로: 초기화 비용과 캐시 사용량이 실제 레코드 수에 비례
+    size_t capacity = capacity_for(expected, default_load_factor);
+    HashTable *table = (HashTable *)arena_alloc(arena, sizeof(HashTable));
+    HashSlot *slots = (HashSlot *)arena_alloc(arena, sizeof(HashSlot) * capacity);
+    if (!table || !slots) {
+        fprintf(stderr, "해시 테이블 할당 실패 (%zu개)\n", capacity);
+        return NULL;
+    }
+
+    table->slots = slots;
+    table->capacity = capacity;
+    table->mask = capacity - 1;
+    table->load_factor = default_load_factor;
+    hash_table_clear(table);
+
+    return table;
+}
+
+void hash_table_clear(HashTable *table) {
+    // value = -1 (모든 바이트 0xFF)이 빈 슬롯
+    memset(table->slots, 0xFF, sizeof(HashSlot) * table->capacity);
+    table->used = 0;
+}
+
+double hash_table_load_factor(const HashTable *table) {
+    return (double)table->used / table->capacity;
+}
+
+int hash_table_insert(HashTable *table, long key, int32_t value) {
+    if (table->used >= table->capacity - 1) {
+        return 0;  // 탐사 종료를 위해 빈 슬롯 하나는 남겨 둠
+    }
+
+    size_t pos = hash_table_slot(table, key);
+    while (table->slots[pos].value >= 0) {
+        pos = (pos + 1) & table->mask;
+    }
+    table->slots[pos].key = key;
+    table->slots[pos].value = value;
+    table->used++;
+    return 1;
+}
+
+int hash_table_insert_atomic(HashTable *table, long key, int32_t value) {
+    // 빈 슬롯의 value를 -1 → value로 CAS하여 차지한 뒤 키 기록
+    // (공유 빌드는 삽입이 모두 끝난 뒤 배리어를 지나 탐색하므로 키 기록 순서는 무관)
+    size_t pos = hash_table_slot(table, key);
+    for (size_t n = 0; n < table->capacity - 1; n++) {
+        int32_t expected = -1;
+        if (__atomic_load_n(&table->slots[pos].value, __ATOMIC_RELAXED) < 0 &&
+            __atomic_compare_exchange_n(&table->slots[pos].value, &expected, value, 0,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            table->slots[pos].key = key;
+            __atomic_fetch_add(&table->used, 1, __ATOMIC_RELAXED);
+            return 1;
+        }
+        pos = (pos + 1) & table->mask;
+    }
+    return 0;  // 테이블이 가득 참
+}
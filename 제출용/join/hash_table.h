@@ -0,0 +1,76 @@
+#ifndef HASH_TABLE_H
+#define HASH_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "arena.h"
+
+// ========================================
+// 선형 탐사 해시 테이블 (Open Addressing)
+// - 키와 Customer 인덱스를 한 슬롯에 나란히 저장 (탐색 시 캐시 미스 1회)
+// - 노드별 malloc/free 없음: 테이블은 스레드 아레나에서 블록마다 새로 잘라 씀
+// - 슬롯 수는 블록의 실제 레코드 수와 목표 적재율로 블록마다 결정 (2의 거듭제곱, 마스크 버킷팅)
+// - 같은 키가 여러 번 들어와도 모두 보관 (hash_table_next로 차례로 조회)
+// ========================================
+
+typedef struct {
+    long key;
+    int32_t value;          // Customer 인덱스 (-1 = 빈 슬롯)
+} HashSlot;
+
+#define HASH_TABLE_DEFAULT_LOAD_FACTOR 0.5
+#define HASH_TABLE_MIN_CAPACITY 16
+
+typedef struct {
+    HashSlot *slots;
+    size_t capacity;        // 현재 사용 중인 슬롯 수 (2의 거듭제곱)
+    size_t mask;            // capacity - 1
+    size_t used;            // 채워진 슬롯 수
+    double load_factor;     // 목표 적재율
+} HashTable;
+
+// 목표 적재율 설정/조회 (이후 생성되는 테이블에 적용, 0.05 ~ 0.95)
+void hash_table_set_default_load_factor(double load_factor);
+double hash_table_get_default_load_factor(void);
+
+// expected개를 목표 적재율 이하로 넣을 수 있는 빈 테이블을 아레나에 생성 (공간 부족 시 NULL)
+// 별도 해제 없음: arena_reset으로 함께 반환
+HashTable* hash_table_create(Arena *arena, size_t expected);
+
+// expected개용 테이블이 차지하는 최대 아레나 공간 (아레나 크기 산정용)
+size_t hash_table_arena_bytes(size_t expected);
+
+// 모든 슬롯을 비움
+void hash_table_clear(HashTable *table);
+
+// 현재 적재율 (used / capacity)
+double hash_table_load_factor(const HashTable *table);
+
+// (key, value) 삽입 (성공 1, 테이블이 가득 찼으면 0)
+int hash_table_insert(HashTable *table, long key, int32_t value);
+
+// 여러 스레드가 동시에 삽입하는 버전 (빈 슬롯을 CAS로 차지, 삽입 중에는 탐색 금지)
+int hash_table_insert_atomic(HashTable *table, long key, int32_t value);
+
+// 키의 첫 탐사 위치
+static inline size_t hash_table_slot(const HashTable *table, long key) {
+    uint64_t h = (uint64_t)key * 0x9E3779B97F4A7C15ULL;
+    return (size_t)(h ^ (h >> 32)) & table->mask;
+}
+
+// *pos부터 탐사하여 key와 일치하는 다음 값 반환 (더 없으면 -1)
+// 사용법: pos = hash_table_slot(table, key); while ((v = hash_table_next(table, key, &pos)) >= 0) ...
+static inline int32_t hash_table_next(const HashTable *table, long key, size_t *pos) {
+    for (;;) {
+        const HashSlot *slot = &table->slots[*pos];
+        if (slot->value < 0) {
+            return -1;  // 빈 슬롯: 탐사 종료
+        }
+        *pos = (*pos + 1) & table->mask;
+        if (slot->key == key) {
+            return slot->value;
+        }
+    }
+}
+
+#endif
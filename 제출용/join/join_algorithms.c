@@ -11,6 +11,14 @@
 #include "join_algorithms.h"
 #include "disk_reader.h"
 #include "disk_save.h"
+#include "hash_table.h"
+#include "direct_table.h"
+#include "bloom_filter.h"
+#include "arena.h"
+#include "radix_partition.h"
+#include "spill.h"
+#include <string.h>
+#include <sys/stat.h>
 
 // ========================================
 // OpenMP 기반 병렬 블록 해시 조인 (결과 저장)
@@ -21,7 +29,8 @@
 // ========================================
 
 long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, const char *order_file, 
-                                                     int block_size, const char *output_file, int num_threads) {
+                                                     int block_size, const char *output_file, int num_threads,
+                                                     DiskReaderStats *stats) {
     // ========================================
     // 1. 출력 파일 초기화 및 준비 단계
     // ========================================
@@ -31,49 +40,29 @@ long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, c
     }
 
     // ========================================
-    // 2. 데이터 크기 파악 및 작업 분배 준비
+    // 2. 작업 분배 준비
     // ========================================
-    // Customer 파일의 총 라인 수 계산 (작업 분배를 위해)
-    FILE *fp = fopen(customer_file, "r");
-    if (!fp) {
-        perror("fopen");
-        return -1;
-    }
-
-    long total_lines = 0;
-    char ch;
-    while ((ch = fgetc(fp)) != EOF) {
-        if (ch == '\n') total_lines++;
-    }
-    fclose(fp);
-
-    printf("총 Customer 레코드: %ld개\n", total_lines);
+    // Customer 파일은 바이트 기준으로 균등 분할 (각 리더가 줄 경계로 맞춰 바로 이동)
+    // → 줄 수를 세기 위한 사전 스캔이 필요 없음
     printf("%d개 스레드로 병렬 처리 시작 (결과 저장 모드)...\n", num_threads);
     printf("출력 파일: %s\n\n", output_file);
 
-    // 각 스레드의 작업 범위 계산 (균등 분배)
-    long chunk_size = total_lines / num_threads;
-
     // ========================================
     // 3. OpenMP 병렬 처리 영역
     // - num_threads: 지정된 스레드 수만큼 병렬 실행
     // - reduction(+:total_result): 각 스레드의 결과를 자동으로 합산
     // ========================================
     long total_result = 0;
+    int failed = 0;  // 한 스레드라도 실패하면 결과가 불완전하므로 -1 반환
 
     #pragma omp parallel for num_threads(num_threads) reduction(+:total_result)
     for (int i = 0; i < num_threads; i++) {
         // ========================================
         // 3.1 각 스레드의 작업 범위 및 초기화
         // ========================================
-        // 각 스레드의 작업 범위 계산
-        long start_line = i * chunk_size;
-        long end_line = (i == num_threads - 1) ? total_lines : (i + 1) * chunk_size;
         int thread_id = i + 1;
         long result_count = 0;
-
-        printf("[Thread %d] 시작: 라인 %ld ~ %ld (결과 저장 버전)\n",
-               thread_id, start_line, end_line);
+        long cust_total = 0;
 
         // ========================================
         // 3.2 파일 및 메모리 리소스 초기화
@@ -86,9 +75,19 @@ long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, c
             fprintf(stderr, "[Thread %d] 파일 열기 실패\n", thread_id);
             if (cust_reader) disk_reader_close(cust_reader);
             if (order_reader) disk_reader_close(order_reader);
+            __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
             continue;  // 오류 시 다음 스레드로
         }
 
+        // 각 스레드는 Customer 파일의 i번째 바이트 범위만 담당
+        disk_reader_set_partition(cust_reader, i, num_threads);
+        printf("[Thread %d] 시작: %s %ld ~ %ld (결과 저장 버전)\n",
+               thread_id, cust_reader->mode == DISK_READER_MODE_COLUMNAR ? "행" : "바이트",
+               cust_reader->range_start, cust_reader->range_end);
+
+        // 프로브 스캔은 조인 키만 파싱 (나머지 컬럼은 매칭 시 지연 파싱)
+        disk_reader_set_columns(order_reader, ORDER_COL_CUSTKEY);
+
         // 메모리 버퍼 할당 (블록 단위 I/O를 위한)
         // block_size에 따른 최대 레코드 수 계산
         int max_cust_records = block_size / sizeof(CustomerRecord);
@@ -102,20 +101,27 @@ long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, c
             free(order_buffer);
             disk_reader_close(cust_reader);
             disk_reader_close(order_reader);
+            __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
             continue;
         }
 
         // ========================================
         // 3.3 해시 테이블 및 결과 버퍼 생성
         // ========================================
-        // 해시 테이블 생성: Customer 키를 O(1)으로 탐색하기 위한 자료구조
-        HashNode **hash_table = (HashNode **)calloc(HASH_SIZE, sizeof(HashNode *));
-        if (!hash_table) {
-            fprintf(stderr, "[Thread %d] 해시 테이블 할당 실패\n", thread_id);
+        // 스레드 전용 아레나 생성: 블록마다 만드는 해시/직접 주소 테이블을 담는 메모리
+        // (블록 하나의 최대 레코드 수 기준으로 한 번만 할당하고 블록마다 O(1)로 비워 재사용)
+        // (블룸 필터는 테이블 뒤에 같은 아레나에서 할당)
+        size_t hash_bytes = hash_table_arena_bytes(max_cust_records);
+        size_t direct_bytes = direct_table_arena_bytes(max_cust_records);
+        size_t bloom_bytes = bloom_filter_get_mode() == BLOOM_FILTER_OFF ? 0 : bloom_filter_arena_bytes(max_cust_records);
+        Arena *arena = arena_create((hash_bytes > direct_bytes ? hash_bytes : direct_bytes) + bloom_bytes);
+        if (!arena) {
+            fprintf(stderr, "[Thread %d] 아레나 할당 실패\n", thread_id);
             free(cust_buffer);
             free(order_buffer);
             disk_reader_close(cust_reader);
             disk_reader_close(order_reader);
+            __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
             continue;
         }
 
@@ -123,153 +129,1337 @@ long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, c
         ResultBuffer *result_buf = result_buffer_create(output_file, 10000);
         if (!result_buf) {
             fprintf(stderr, "[Thread %d] 결과 버퍼 할당 실패\n", thread_id);
-            free(hash_table);
+            arena_destroy(arena);
             free(cust_buffer);
             free(order_buffer);
             disk_reader_close(cust_reader);
             disk_reader_close(order_reader);
+            __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
             continue;
         }
 
         // ========================================
-        // 3.4 작업 범위 시작 위치로 이동
+        // 3.4 메인 처리 루프: 블록 단위 해시 조인 수행
         // ========================================
-        // 각 스레드가 담당하는 start_line까지 Customer 파일을 스킵
-        CustomerRecord temp;
-        for (long j = 0; j < start_line; j++) {
-            if (!disk_reader_read_customer(cust_reader, &temp)) {
-                break;
-            }
-        }
+        int cust_count;
+        long hash_blocks = 0;
+        long direct_blocks = 0;
+        long hash_keys_total = 0;
+        size_t hash_slots_total = 0;
+        size_t hash_capacity_max = 0;
+        long bloom_checks = 0;
+        long bloom_rejects = 0;
+        long range_filter_blocks = 0;
 
         // ========================================
-        // 3.5 메인 처리 루프: 블록 단위 해시 조인 수행
+        // 3.4.1 Customer 블록 읽기 (외부 루프)
         // ========================================
-        long current_line = start_line;
-        int cust_count;
-        long initial_io;
+        // 리더의 I/O 블록 하나 분량을 일괄로 읽기 (담당 범위 끝에서 0 반환)
+        while (disk_reader_read_customers_batch(cust_reader, cust_buffer, max_cust_records, &cust_count)) {
+            cust_total += cust_count;
 
-        while (current_line < end_line) {
             // ========================================
-            // 3.5.1 Customer 블록 읽기 (외부 루프)
+            // 3.4.2 직접 주소/해시 테이블 구축 (Customer 데이터를 인덱싱)
             // ========================================
-            cust_count = 0;
-            initial_io = disk_reader_get_io_count();
+            // 이전 블록의 구조체를 한 번에 버림
+            arena_reset(arena);
 
-            // Customer 블록 읽기: 메모리 버퍼 크기 또는 I/O 블록 제한까지
-            while (cust_count < max_cust_records && current_line < end_line) {
-                if (!disk_reader_read_customer(cust_reader, &cust_buffer[cust_count])) {
-                    break;
+            // 키 범위가 촘촘하면 (TPC-H C_CUSTKEY) key - min을 그대로 배열 인덱스로 사용
+            DirectTable *direct = NULL;
+            long min_key = cust_buffer[0].custkey;
+            long max_key = cust_buffer[0].custkey;
+            int sorted = 1;
+            for (int j = 1; j < cust_count; j++) {
+                long key = cust_buffer[j].custkey;
+                if (key < min_key) min_key = key;
+                if (key > max_key) max_key = key;
+                if (key < cust_buffer[j - 1].custkey) sorted = 0;
+            }
+            if (direct_table_is_dense(min_key, max_key, cust_count)) {
+                direct = direct_table_create(arena, min_key, max_key);
+                for (int j = 0; direct && j < cust_count; j++) {
+                    if (!direct_table_insert(direct, cust_buffer[j].custkey, j)) {
+                        direct = NULL;  // 중복 키: 해시 테이블로 대체
+                        arena_reset(arena);
+                    }
                 }
-                cust_count++;
-                current_line++;
+            }
 
-                if (disk_reader_get_io_count() - initial_io >= 1) {
+            // 범위가 희소하거나 중복 키가 있으면 실제 레코드 수에 맞춘 해시 테이블에 삽입
+            HashTable *hash_table = NULL;
+            if (direct) {
+                direct_blocks++;
+            } else {
+                hash_table = hash_table_create(arena, cust_count);
+                if (!hash_table) {
+                    fprintf(stderr, "[Thread %d] 해시 테이블 생성 실패 (%d개)\n", thread_id, cust_count);
+                    __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
                     break;
                 }
+                for (int j = 0; j < cust_count; j++) {
+                    hash_table_insert(hash_table, cust_buffer[j].custkey, j);
+                }
+                hash_blocks++;
+                hash_keys_total += cust_count;
+                hash_slots_total += hash_table->capacity;
+                if (hash_table->capacity > hash_capacity_max) {
+                    hash_capacity_max = hash_table->capacity;
+                }
             }
 
-            if (cust_count == 0) break;
-
-            // ========================================
-            // 3.5.2 해시 테이블 구축 (Customer 데이터를 인덱싱)
-            // ========================================
-            // 읽은 Customer 블록을 해시 테이블에 삽입하여 빠른 탐색 준비
-            for (int j = 0; j < cust_count; j++) {
-                long key = cust_buffer[j].custkey;
-                int hash = key % HASH_SIZE;
-
-                HashNode *node = (HashNode *)malloc(sizeof(HashNode));
-                node->custkey = key;
-                node->customer_idx = j;
-                node->next = hash_table[hash];
-                hash_table[hash] = node;
+            // 블룸 필터: auto는 해시 테이블 블록에만 (직접 주소 테이블은 범위 검사 + 배열 읽기 1번)
+            BloomFilter *bloom = NULL;
+            BloomFilterMode bloom_mode = bloom_filter_get_mode();
+            if (bloom_mode == BLOOM_FILTER_ON || (bloom_mode == BLOOM_FILTER_AUTO && !direct)) {
+                bloom = bloom_filter_create(arena, cust_count);
+                for (int j = 0; bloom && j < cust_count; j++) {
+                    bloom_filter_add(bloom, cust_buffer[j].custkey);
+                }
             }
 
             // ========================================
-            // 3.5.3 Orders 테이블 전체 스캔 및 조인 수행 (내부 루프)
+            // 3.4.3 Orders 테이블 전체 스캔 및 조인 수행 (내부 루프)
             // ========================================
             disk_reader_reset(order_reader);  // Order 파일을 처음부터 다시 읽기 시작
 
+            // 키 범위 필터: Customer 파일이 C_CUSTKEY 순으로 정렬되어 있으면(dbgen 기본)
+            // 블록마다 키 범위가 겹치지 않으므로 범위 밖 Order는 리더에서 키만 보고 버림
+            // (정렬되지 않은 블록은 범위가 넓어 거의 걸러지지 않으므로 적용하지 않음)
+            if (sorted) {
+                disk_reader_set_key_filter(order_reader, min_key, max_key);
+                range_filter_blocks++;
+            } else {
+                disk_reader_clear_key_filter(order_reader);
+            }
+
             // Orders 전체 스캔 (블록 단위로 읽으며 조인 수행)
             int order_count;
-            while (1) {
-                order_count = 0;
-                initial_io = disk_reader_get_io_count();
+            while (disk_reader_read_orders_batch(order_reader, order_buffer, max_order_records, &order_count)) {
+                // ========================================
+                // 3.4.4 해시 테이블 탐색 및 결과 매칭/저장
+                // ========================================
+                // 각 Order 레코드에 대해 직접 주소/해시 테이블에서 Customer 매칭 탐색
+                // (Order는 O_CUSTKEY만 파싱되어 있으므로 매칭된 행만 전체 컬럼을 읽음)
+                // (블룸 필터가 있으면 테이블 탐색 전에 확실히 없는 키를 걸러냄)
+                if (bloom) {
+                    bloom_checks += order_count;
+                }
+                if (direct) {
+                    for (int j = 0; j < order_count; j++) {
+                        if (bloom && !bloom_filter_may_contain(bloom, order_buffer[j].custkey)) {
+                            bloom_rejects++;
+                            continue;
+                        }
+                        int32_t idx = direct_table_find(direct, order_buffer[j].custkey);
+                        if (idx >= 0) {
+                            disk_reader_materialize_order(order_reader, j, &order_buffer[j]);
+                            result_buffer_add(result_buf, &cust_buffer[idx], &order_buffer[j]);
+                            result_count++;
+                        }
+                    }
+                    continue;
+                }
 
-                // Order 블록 읽기
-                while (order_count < max_order_records) {
-                    if (!disk_reader_read_order(order_reader, &order_buffer[order_count])) {
-                        break;
+                for (int j = 0; j < order_count; j++) {
+                    long key = order_buffer[j].custkey;
+                    if (bloom && !bloom_filter_may_contain(bloom, key)) {
+                        bloom_rejects++;
+                        continue;
                     }
-                    order_count++;
+                    size_t pos = hash_table_slot(hash_table, key);
+                    int materialized = 0;
+                    int32_t idx;
+
+                    while ((idx = hash_table_next(hash_table, key, &pos)) >= 0) {
+                        if (!materialized) {
+                            disk_reader_materialize_order(order_reader, j, &order_buffer[j]);
+                            materialized = 1;
+                        }
+                        // 매칭 성공: Customer와 Order 정보를 결과 버퍼에 추가
+                        result_buffer_add(result_buf, &cust_buffer[idx], &order_buffer[j]);
+                        result_count++;
+                    }
+                }
+            }
+        }
+
+        printf("[Thread %d] 완료: Customer %ld건, %ld건 매칭 및 저장\n", thread_id, cust_total, result_count);
+        if (direct_blocks > 0) {
+            printf("[Thread %d] 직접 주소 테이블: 블록 %ld개\n", thread_id, direct_blocks);
+        }
+        if (hash_blocks > 0) {
+            printf("[Thread %d] 해시 테이블: 최대 슬롯 %zu개, 평균 적재율 %.2f (목표 %.2f, 블록 %ld개)\n",
+                   thread_id, hash_capacity_max, (double)hash_keys_total / hash_slots_total,
+                   hash_table_get_default_load_factor(), hash_blocks);
+        }
+        if (range_filter_blocks > 0) {
+            printf("[Thread %d] 키 범위 필터: 정렬된 블록 %ld개에 적용\n", thread_id, range_filter_blocks);
+        }
+        if (bloom_checks > 0) {
+            printf("[Thread %d] 블룸 필터: 탐색 %ld건 중 %ld건 차단 (%.1f%%)\n",
+                   thread_id, bloom_checks, bloom_rejects, 100.0 * bloom_rejects / bloom_checks);
+        }
+
+        // 스레드별 I/O/파싱 통계 (스레드 확장성 분석용)
+        DiskReaderStats thread_stats = {0};
+        DiskReaderStats reader_stats;
+        char label[64];
+        disk_reader_get_stats(cust_reader, &reader_stats);
+        snprintf(label, sizeof(label), "[Thread %d] Customer: ", thread_id);
+        disk_reader_stats_print(label, &reader_stats);
+        disk_reader_stats_merge(&thread_stats, &reader_stats);
+        disk_reader_get_stats(order_reader, &reader_stats);
+        snprintf(label, sizeof(label), "[Thread %d] Orders:   ", thread_id);
+        disk_reader_stats_print(label, &reader_stats);
+        disk_reader_stats_merge(&thread_stats, &reader_stats);
+
+        if (stats) {
+            #pragma omp critical(join_stats)
+            disk_reader_stats_merge(stats, &thread_stats);
+        }
+
+        // ========================================
+        // 3.5 리소스 정리 및 마무리
+        // ========================================
+        // 남은 결과 플러시 및 모든 리소스 해제
+        result_buffer_destroy(result_buf);
+        arena_destroy(arena);
+        free(cust_buffer);
+        free(order_buffer);
+        disk_reader_close(cust_reader);
+        disk_reader_close(order_reader);
+
+        total_result += result_count;
+    }
+
+    // ========================================
+    // 4. 최종 결과 파일 마무리
+    // ========================================
+    if (failed) {
+        fprintf(stderr, "블록 조인 실패\n");
+        return -1;
+    }
+
+    // 출력 파일에 통계 정보 추가 및 최종 정리
+    disk_save_finalize(output_file, total_result);
+
+    printf("\n병렬 처리 완료 (결과 저장 버전)!\n");
+    return total_result;
+}
+
+// ========================================
+// 공유 빌드 + 병렬 프로브 해시 조인 (결과 저장)
+// - 모든 스레드가 Customer를 나눠 읽어 하나의 공유 테이블을 함께 구축 (CAS 삽입)
+// - 배리어 이후 Order 파일을 바이트 범위로 나눠 각 스레드가 자기 범위만 탐색
+// → Order는 정확히 한 번만 읽고 파싱됨 (블록 조인은 스레드 수 × 블록 수만큼 반복)
+// - Customer 전체가 메모리에 들어갈 때 사용 (disk_parallel_join_save가 선택)
+// ========================================
+
+// 스레드 로컬 Customer 배열을 최소 need개 담도록 확장
+static int reserve_customers(CustomerRecord **records, long *capacity, long need) {
+    if (need <= *capacity) {
+        return 1;
+    }
+    long new_capacity = *capacity ? *capacity : 1024;
+    while (new_capacity < need) {
+        new_capacity *= 2;
+    }
+    CustomerRecord *grown = (CustomerRecord *)realloc(*records, sizeof(CustomerRecord) * new_capacity);
+    if (!grown) {
+        return 0;
+    }
+    *records = grown;
+    *capacity = new_capacity;
+    return 1;
+}
+
+long disk_parallel_shared_hash_join_save(const char *customer_file, const char *order_file,
+                                         int block_size, const char *output_file, int num_threads,
+                                         DiskReaderStats *stats) {
+    // ========================================
+    // 1. 출력 파일 초기화 및 공유 상태 준비
+    // ========================================
+    if (disk_save_init(output_file) != 0) {
+        fprintf(stderr, "출력 파일 초기화 실패\n");
+        return -1;
+    }
+
+    printf("%d개 스레드로 병렬 처리 시작 (공유 빌드 + 병렬 프로브)...\n", num_threads);
+    printf("출력 파일: %s\n\n", output_file);
+
+    long *part_offset = (long *)calloc(num_threads + 1, sizeof(long));  // 스레드별 Customer 시작 위치
+    if (!part_offset) {
+        fprintf(stderr, "작업 분배 배열 할당 실패\n");
+        return -1;
+    }
 
-                    if (disk_reader_get_io_count() - initial_io >= 1) {
+    CustomerRecord *customers = NULL;  // 모든 스레드의 Customer (공유 빌드 입력)
+    long total_customers = 0;
+    long min_key = 0, max_key = 0;
+    int have_keys = 0;
+    Arena *arena = NULL;               // 공유 테이블 메모리
+    DirectTable *direct = NULL;
+    HashTable *hash_table = NULL;
+    int duplicate = 0;                 // 직접 주소 테이블에서 중복 키 발견
+    int failed = 0;
+    long total_result = 0;
+
+    // ========================================
+    // 2. OpenMP 병렬 처리 영역 (단계 사이는 배리어로 동기화)
+    // ========================================
+    #pragma omp parallel num_threads(num_threads) reduction(+:total_result)
+    {
+        int i = omp_get_thread_num();
+        int thread_id = i + 1;
+        long result_count = 0;
+
+        DiskReader *cust_reader = disk_reader_open(customer_file, "customer", block_size);
+        DiskReader *order_reader = disk_reader_open(order_file, "order", block_size);
+        int max_cust_records = block_size / sizeof(CustomerRecord);
+        int max_order_records = block_size / sizeof(OrderRecord);
+        OrderRecord *order_buffer = (OrderRecord *)malloc(sizeof(OrderRecord) * max_order_records);
+        ResultBuffer *result_buf = result_buffer_create(output_file, 10000);
+        if (!cust_reader || !order_reader || !order_buffer || !result_buf) {
+            fprintf(stderr, "[Thread %d] 리소스 할당 실패\n", thread_id);
+            __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+        }
+
+        // ========================================
+        // 2.1 Customer 분할 읽기 (스레드 로컬 배열)
+        // ========================================
+        CustomerRecord *local = NULL;
+        long local_count = 0, local_capacity = 0;
+        long local_min = 0, local_max = 0;
+        if (cust_reader) {
+            disk_reader_set_partition(cust_reader, i, num_threads);
+            int n;
+            while (1) {
+                // 배열 확장 실패는 입력 끝이 아니므로 실패로 처리 (일부 Customer만으로 조인하지 않음)
+                if (!reserve_customers(&local, &local_capacity, local_count + max_cust_records)) {
+                    fprintf(stderr, "[Thread %d] Customer 배열 확장 실패\n", thread_id);
+                    __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+                    break;
+                }
+                if (!disk_reader_read_customers_batch(cust_reader, local + local_count, max_cust_records, &n)) {
+                    break;
+                }
+                for (int j = 0; j < n; j++) {
+                    long key = local[local_count + j].custkey;
+                    if (local_count + j == 0 || key < local_min) local_min = key;
+                    if (local_count + j == 0 || key > local_max) local_max = key;
+                }
+                local_count += n;
+            }
+        }
+        part_offset[i + 1] = local_count;
+        if (local_count > 0) {
+            #pragma omp critical(shared_key_range)
+            {
+                if (!have_keys || local_min < min_key) min_key = local_min;
+                if (!have_keys || local_max > max_key) max_key = local_max;
+                have_keys = 1;
+            }
+        }
+        printf("[Thread %d] Customer %s %ld ~ %ld: %ld건\n", thread_id,
+               cust_reader && cust_reader->mode == DISK_READER_MODE_COLUMNAR ? "행" : "바이트",
+               cust_reader ? cust_reader->range_start : 0, cust_reader ? cust_reader->range_end : 0, local_count);
+
+        #pragma omp barrier
+
+        // ========================================
+        // 2.2 공유 배열/테이블 할당 (한 스레드만)
+        // ========================================
+        #pragma omp single
+        {
+            for (int t = 0; t < num_threads; t++) {
+                part_offset[t + 1] += part_offset[t];
+            }
+            total_customers = part_offset[num_threads];
+
+            size_t hash_bytes = hash_table_arena_bytes(total_customers);
+            size_t direct_bytes = direct_table_arena_bytes(total_customers);
+            customers = (CustomerRecord *)malloc(sizeof(CustomerRecord) * (total_customers ? total_customers : 1));
+            arena = arena_create(hash_bytes + direct_bytes);  // 중복 키로 해시 테이블 재구축 시 여유
+            if (!customers || !arena) {
+                fprintf(stderr, "공유 빌드 메모리 할당 실패\n");
+                failed = 1;
+            } else if (have_keys && direct_table_is_dense(min_key, max_key, total_customers)) {
+                direct = direct_table_create(arena, min_key, max_key);
+            } else {
+                hash_table = hash_table_create(arena, total_customers);
+            }
+            if (!failed && !direct && !hash_table) {
+                failed = 1;
+            }
+        }
+
+        // ========================================
+        // 2.3 공유 테이블 동시 구축
+        // ========================================
+        long begin = part_offset[i];
+        if (!failed) {
+            memcpy(customers + begin, local, sizeof(CustomerRecord) * local_count);
+            for (long j = 0; j < local_count; j++) {
+                long key = local[j].custkey;
+                if (direct) {
+                    if (!direct_table_insert_atomic(direct, key, (int32_t)(begin + j))) {
+                        __atomic_store_n(&duplicate, 1, __ATOMIC_RELAXED);
                         break;
                     }
+                } else {
+                    hash_table_insert_atomic(hash_table, key, (int32_t)(begin + j));
                 }
+            }
+        }
+        free(local);
 
-                if (order_count == 0) break;
+        #pragma omp barrier
 
-                // ========================================
-                // 3.5.4 해시 테이블 탐색 및 결과 매칭/저장
-                // ========================================
-                // 각 Order 레코드에 대해 해시 테이블에서 Customer 매칭 탐색
+        // 중복 키가 있으면 직접 주소 테이블을 버리고 해시 테이블로 다시 구축
+        #pragma omp single
+        if (!failed && duplicate) {
+            direct = NULL;
+            hash_table = hash_table_create(arena, total_customers);
+            if (!hash_table) {
+                failed = 1;
+            }
+        }
+        if (!failed && duplicate) {
+            for (long j = 0; j < local_count; j++) {
+                hash_table_insert_atomic(hash_table, customers[begin + j].custkey, (int32_t)(begin + j));
+            }
+        }
+
+        #pragma omp barrier
+
+        #pragma omp single
+        if (!failed) {
+            if (direct) {
+                printf("공유 직접 주소 테이블: Customer %ld건, 키 범위 %ld ~ %ld\n\n",
+                       total_customers, min_key, max_key);
+            } else {
+                printf("공유 해시 테이블: Customer %ld건, 슬롯 %zu개, 적재율 %.2f\n\n",
+                       total_customers, hash_table->capacity, hash_table_load_factor(hash_table));
+            }
+        }
+
+        // ========================================
+        // 2.4 Order 분할 탐색 (각 Order는 한 번만 읽음)
+        // ========================================
+        if (!failed) {
+            disk_reader_set_partition(order_reader, i, num_threads);
+            disk_reader_set_columns(order_reader, ORDER_COL_CUSTKEY);
+
+            int order_count;
+            while (disk_reader_read_orders_batch(order_reader, order_buffer, max_order_records, &order_count)) {
                 for (int j = 0; j < order_count; j++) {
                     long key = order_buffer[j].custkey;
-                    int hash = key % HASH_SIZE;
-
-                    HashNode *node = hash_table[hash];
-                    while (node) {
-                        if (node->custkey == key) {
-                            // 매칭 성공: Customer와 Order 정보를 결과 버퍼에 추가
-                            result_buffer_add(result_buf,
-                                            &cust_buffer[node->customer_idx],
-                                            &order_buffer[j]);
+                    if (direct) {
+                        int32_t idx = direct_table_find(direct, key);
+                        if (idx >= 0) {
+                            disk_reader_materialize_order(order_reader, j, &order_buffer[j]);
+                            result_buffer_add(result_buf, &customers[idx], &order_buffer[j]);
                             result_count++;
                         }
-                        node = node->next;
+                        continue;
+                    }
+
+                    size_t pos = hash_table_slot(hash_table, key);
+                    int materialized = 0;
+                    int32_t idx;
+                    while ((idx = hash_table_next(hash_table, key, &pos)) >= 0) {
+                        if (!materialized) {
+                            disk_reader_materialize_order(order_reader, j, &order_buffer[j]);
+                            materialized = 1;
+                        }
+                        result_buffer_add(result_buf, &customers[idx], &order_buffer[j]);
+                        result_count++;
                     }
                 }
             }
+            printf("[Thread %d] 완료: Order %s %ld ~ %ld, %ld건 매칭 및 저장\n", thread_id,
+                   order_reader->mode == DISK_READER_MODE_COLUMNAR ? "행" : "바이트", order_reader->range_start, order_reader->range_end, result_count);
+        }
 
-            // ========================================
-            // 3.5.5 해시 테이블 정리 (메모리 누수 방지)
-            // ========================================
-            // 현재 블록의 해시 테이블을 완전히 해제하여 다음 블록 준비
-            for (int j = 0; j < HASH_SIZE; j++) {
-                HashNode *node = hash_table[j];
-                while (node) {
-                    HashNode *temp = node;
-                    node = node->next;
-                    free(temp);
+        // ========================================
+        // 2.5 스레드별 통계 및 리소스 정리
+        // ========================================
+        DiskReaderStats thread_stats = {0};
+        DiskReaderStats reader_stats;
+        char label[64];
+        if (cust_reader) {
+            disk_reader_get_stats(cust_reader, &reader_stats);
+            snprintf(label, sizeof(label), "[Thread %d] Customer: ", thread_id);
+            disk_reader_stats_print(label, &reader_stats);
+            disk_reader_stats_merge(&thread_stats, &reader_stats);
+        }
+        if (order_reader) {
+            disk_reader_get_stats(order_reader, &reader_stats);
+            snprintf(label, sizeof(label), "[Thread %d] Orders:   ", thread_id);
+            disk_reader_stats_print(label, &reader_stats);
+            disk_reader_stats_merge(&thread_stats, &reader_stats);
+        }
+        if (stats) {
+            #pragma omp critical(join_stats)
+            disk_reader_stats_merge(stats, &thread_stats);
+        }
+
+        if (result_buf) result_buffer_destroy(result_buf);
+        free(order_buffer);
+        if (cust_reader) disk_reader_close(cust_reader);
+        if (order_reader) disk_reader_close(order_reader);
+
+        total_result += result_count;
+    }
+
+    // ========================================
+    // 3. 공유 메모리 해제 및 결과 파일 마무리
+    // ========================================
+    arena_destroy(arena);
+    free(customers);
+    free(part_offset);
+    if (failed) {
+        fprintf(stderr, "공유 빌드 조인 실패\n");
+        return -1;
+    }
+
+    disk_save_finalize(output_file, total_result);
+
+    printf("\n병렬 처리 완료 (공유 빌드 버전)!\n");
+    return total_result;
+}
+
+// ========================================
+// 병렬 기수 분할 해시 조인 (결과 저장)
+// - Customer는 (키, 공유 배열 인덱스), Order는 (키, 행 위치) 튜플로 줄여 키 해시로 기수 분할
+// - 파티션마다 빌드 테이블이 L2 캐시에 들어가므로 탐색이 캐시 미스 없이 진행됨
+// - 분할: 스레드별 히스토그램 → 접두 합 → 흩뿌리기 (1패스), 팬아웃이 크면 파티션별 2패스
+// - 조인: 파티션 단위로 스레드에 동적 분배, 매칭된 Order만 행 위치로 다시 읽어 전체 컬럼 파싱
+// ========================================
+
+// 스레드 로컬 튜플 배열을 최소 need개 담도록 확장
+static int reserve_tuples(JoinTuple **tuples, long *capacity, long need) {
+    if (need <= *capacity) {
+        return 1;
+    }
+    long new_capacity = *capacity ? *capacity : 4096;
+    while (new_capacity < need) {
+        new_capacity *= 2;
+    }
+    JoinTuple *grown = (JoinTuple *)realloc(*tuples, sizeof(JoinTuple) * new_capacity);
+    if (!grown) {
+        return 0;
+    }
+    *tuples = grown;
+    *capacity = new_capacity;
+    return 1;
+}
+
+// 1패스 분할 결과 [begin, end)를 2패스로 다시 나눠 out에 기록하고 파티션 경계를 bounds에 저장
+static void radix_refine(const JoinTuple *in, long begin, long end, int shift, int bits,
+                         JoinTuple *out, long *bounds) {
+    int fanout = 1 << bits;
+    long cursor[1 << RADIX_PASS_BITS] = {0};
+
+    radix_histogram(in + begin, end - begin, shift, bits, cursor);
+    long pos = begin;
+    for (int q = 0; q < fanout; q++) {
+        long count = cursor[q];
+        bounds[q] = pos;
+        cursor[q] = pos;
+        pos += count;
+    }
+    radix_scatter(in + begin, end - begin, shift, bits, cursor, out);
+}
+
+long disk_parallel_radix_hash_join_save(const char *customer_file, const char *order_file,
+                                        int block_size, const char *output_file, int num_threads,
+                                        DiskReaderStats *stats) {
+    // ========================================
+    // 1. 출력 파일 초기화 및 공유 상태 준비
+    // ========================================
+    if (disk_save_init(output_file) != 0) {
+        fprintf(stderr, "출력 파일 초기화 실패\n");
+        return -1;
+    }
+
+    printf("%d개 스레드로 병렬 처리 시작 (기수 분할 해시 조인)...\n", num_threads);
+    printf("출력 파일: %s\n\n", output_file);
+
+    long *cust_offset = (long *)calloc(num_threads + 1, sizeof(long));   // 스레드별 Customer 시작 위치
+    long *order_offset = (long *)calloc(num_threads + 1, sizeof(long));  // 스레드별 Order 튜플 수
+    long *cust_hist = (long *)calloc((size_t)num_threads << RADIX_PASS_BITS, sizeof(long));
+    long *order_hist = (long *)calloc((size_t)num_threads << RADIX_PASS_BITS, sizeof(long));
+    long *cust_bounds = (long *)malloc(sizeof(long) * (((size_t)1 << RADIX_MAX_BITS) + 1));
+    long *order_bounds = (long *)malloc(sizeof(long) * (((size_t)1 << RADIX_MAX_BITS) + 1));
+    if (!cust_offset || !order_offset || !cust_hist || !order_hist || !cust_bounds || !order_bounds) {
+        fprintf(stderr, "작업 분배 배열 할당 실패\n");
+        free(cust_offset);
+        free(order_offset);
+        free(cust_hist);
+        free(order_hist);
+        free(cust_bounds);
+        free(order_bounds);
+        return -1;
+    }
+
+    CustomerRecord *customers = NULL;  // 모든 스레드의 Customer (튜플 페이로드가 가리키는 배열)
+    JoinTuple *cust_pass1 = NULL, *order_pass1 = NULL;  // 1패스 분할 결과
+    JoinTuple *cust_parts = NULL, *order_parts = NULL;  // 최종 분할 결과 (2패스가 없으면 1패스 결과)
+    long total_customers = 0, total_orders = 0;
+    long max_part_customers = 0;
+    int bits1 = 0, bits2 = 0;
+    int failed = 0;
+    long total_result = 0;
+
+    // ========================================
+    // 2. OpenMP 병렬 처리 영역 (단계 사이는 배리어로 동기화)
+    // ========================================
+    #pragma omp parallel num_threads(num_threads) reduction(+:total_result)
+    {
+        int i = omp_get_thread_num();
+        int thread_id = i + 1;
+        long result_count = 0;
+
+        DiskReader *cust_reader = disk_reader_open(customer_file, "customer", block_size);
+        DiskReader *order_reader = disk_reader_open(order_file, "order", block_size);
+        int max_cust_records = block_size / sizeof(CustomerRecord);
+        int max_order_records = block_size / sizeof(OrderRecord);
+        OrderRecord *order_buffer = (OrderRecord *)malloc(sizeof(OrderRecord) * max_order_records);
+        ResultBuffer *result_buf = result_buffer_create(output_file, 10000);
+        if (!cust_reader || !order_reader || !order_buffer || !result_buf) {
+            fprintf(stderr, "[Thread %d] 리소스 할당 실패\n", thread_id);
+            __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+        }
+
+        // ========================================
+        // 2.1 Customer/Order 분할 읽기 (스레드 로컬 배열, Order는 키와 행 위치만)
+        // ========================================
+        CustomerRecord *local = NULL;
+        long local_count = 0, local_capacity = 0;
+        if (cust_reader) {
+            disk_reader_set_partition(cust_reader, i, num_threads);
+            int n;
+            while (1) {
+                // 배열 확장 실패는 입력 끝이 아니므로 실패로 처리 (잘린 분할 입력으로 조인하지 않음)
+                if (!reserve_customers(&local, &local_capacity, local_count + max_cust_records)) {
+                    fprintf(stderr, "[Thread %d] Customer 배열 확장 실패\n", thread_id);
+                    __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+                    break;
+                }
+                if (!disk_reader_read_customers_batch(cust_reader, local + local_count, max_cust_records, &n)) {
+                    break;
+                }
+                local_count += n;
+            }
+        }
+
+        JoinTuple *order_local = NULL;
+        long order_count = 0, order_capacity = 0;
+        if (order_reader && order_buffer) {
+            disk_reader_set_partition(order_reader, i, num_threads);
+            disk_reader_set_columns(order_reader, ORDER_COL_CUSTKEY);
+            int n;
+            while (1) {
+                if (!reserve_tuples(&order_local, &order_capacity, order_count + max_order_records)) {
+                    fprintf(stderr, "[Thread %d] Order 튜플 배열 확장 실패\n", thread_id);
+                    __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+                    break;
+                }
+                if (!disk_reader_read_orders_batch(order_reader, order_buffer, max_order_records, &n)) {
+                    break;
+                }
+                for (int j = 0; j < n; j++) {
+                    order_local[order_count + j].key = order_buffer[j].custkey;
+                    order_local[order_count + j].payload = disk_reader_order_locator(order_reader, j);
                 }
-                hash_table[j] = NULL;
+                order_count += n;
             }
         }
+        cust_offset[i + 1] = local_count;
+        order_offset[i + 1] = order_count;
 
-        printf("[Thread %d] 완료: %ld건 매칭 및 저장\n", thread_id, result_count);
+        #pragma omp barrier
 
         // ========================================
-        // 3.6 리소스 정리 및 마무리
+        // 2.2 전체 크기 집계 및 분할 비트 결정 (한 스레드만)
         // ========================================
-        // 남은 결과 플러시 및 모든 리소스 해제
-        result_buffer_destroy(result_buf);
-        free(hash_table);
+        #pragma omp single
+        {
+            for (int t = 0; t < num_threads; t++) {
+                cust_offset[t + 1] += cust_offset[t];
+                order_offset[t + 1] += order_offset[t];
+            }
+            total_customers = cust_offset[num_threads];
+            total_orders = order_offset[num_threads];
+
+            // 파티션 빌드 테이블(키당 슬롯 = 16바이트 / 적재율)이 L2에 들어가도록 분할
+            size_t bytes_per_key = (size_t)(sizeof(HashSlot) / hash_table_get_default_load_factor()) + 1;
+            int bits = radix_partition_bits(total_customers, bytes_per_key);
+            bits1 = bits < RADIX_PASS_BITS ? bits : RADIX_PASS_BITS;
+            bits2 = bits - bits1;
+
+            customers = (CustomerRecord *)malloc(sizeof(CustomerRecord) * (total_customers ? total_customers : 1));
+            cust_pass1 = (JoinTuple *)malloc(sizeof(JoinTuple) * (total_customers ? total_customers : 1));
+            order_pass1 = (JoinTuple *)malloc(sizeof(JoinTuple) * (total_orders ? total_orders : 1));
+            if (!customers || !cust_pass1 || !order_pass1) {
+                fprintf(stderr, "기수 분할 메모리 할당 실패\n");
+                failed = 1;
+            }
+            printf("기수 분할: Customer %ld건, Order %ld건, 파티션 %d개 (%d패스)\n\n",
+                   total_customers, total_orders, 1 << bits, bits2 > 0 ? 2 : 1);
+        }
+
+        // ========================================
+        // 2.3 1패스 분할: 스레드별 히스토그램 → 접두 합 → 흩뿌리기
+        // ========================================
+        int fanout1 = 1 << bits1;
+        int shift1 = 64 - bits1;
+        long *my_cust_hist = cust_hist + ((size_t)i << RADIX_PASS_BITS);
+        long *my_order_hist = order_hist + ((size_t)i << RADIX_PASS_BITS);
+        JoinTuple *cust_local = NULL;
+        long begin = cust_offset[i];
+
+        if (!failed) {
+            // Customer 레코드는 공유 배열로 옮기고 튜플에는 그 인덱스를 담음
+            memcpy(customers + begin, local, sizeof(CustomerRecord) * local_count);
+            cust_local = (JoinTuple *)malloc(sizeof(JoinTuple) * (local_count ? local_count : 1));
+            if (cust_local) {
+                for (long j = 0; j < local_count; j++) {
+                    cust_local[j].key = local[j].custkey;
+                    cust_local[j].payload = begin + j;
+                }
+                radix_histogram(cust_local, local_count, shift1, bits1, my_cust_hist);
+            } else {
+                __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+            }
+            radix_histogram(order_local, order_count, shift1, bits1, my_order_hist);
+        }
+        free(local);
+
+        #pragma omp barrier
+
+        // 파티션 p 안에서 스레드 t가 쓸 위치 = (p 이전 파티션 전체) + (p에서 t 이전 스레드들)
+        #pragma omp single
+        {
+            long cust_pos = 0, order_pos = 0;
+            for (int p = 0; p < fanout1; p++) {
+                cust_bounds[p] = cust_pos;
+                order_bounds[p] = order_pos;
+                for (int t = 0; t < num_threads; t++) {
+                    long *ch = cust_hist + ((size_t)t << RADIX_PASS_BITS);
+                    long *oh = order_hist + ((size_t)t << RADIX_PASS_BITS);
+                    long c = ch[p], o = oh[p];
+                    ch[p] = cust_pos;
+                    oh[p] = order_pos;
+                    cust_pos += c;
+                    order_pos += o;
+                }
+            }
+            cust_bounds[fanout1] = cust_pos;
+            order_bounds[fanout1] = order_pos;
+        }
+
+        if (!failed) {
+            radix_scatter(cust_local, local_count, shift1, bits1, my_cust_hist, cust_pass1);
+            radix_scatter(order_local, order_count, shift1, bits1, my_order_hist, order_pass1);
+        }
+        free(cust_local);
+        free(order_local);
+
+        #pragma omp barrier
+
+        // ========================================
+        // 2.4 2패스 분할: 1패스 파티션을 스레드에 나눠 각자 다시 분할
+        // ========================================
+        #pragma omp single
+        if (!failed) {
+            if (bits2 > 0) {
+                cust_parts = (JoinTuple *)malloc(sizeof(JoinTuple) * (total_customers ? total_customers : 1));
+                order_parts = (JoinTuple *)malloc(sizeof(JoinTuple) * (total_orders ? total_orders : 1));
+                if (!cust_parts || !order_parts) {
+                    fprintf(stderr, "기수 분할 메모리 할당 실패\n");
+                    failed = 1;
+                }
+            } else {
+                cust_parts = cust_pass1;
+                order_parts = order_pass1;
+            }
+        }
+
+        if (!failed && bits2 > 0) {
+            int fanout2 = 1 << bits2;
+            int shift2 = 64 - bits1 - bits2;
+
+            // 1패스 경계는 쓰기 전에 읽어야 하므로 전체 경계를 먼저 복사해 둠
+            #pragma omp single
+            {
+                for (int p = fanout1; p >= 0; p--) {
+                    cust_bounds[(size_t)p * fanout2] = cust_bounds[p];
+                    order_bounds[(size_t)p * fanout2] = order_bounds[p];
+                }
+            }
+
+            #pragma omp for schedule(dynamic)
+            for (int p = 0; p < fanout1; p++) {
+                long cb = cust_bounds[(size_t)p * fanout2], ce = cust_bounds[(size_t)(p + 1) * fanout2];
+                long ob = order_bounds[(size_t)p * fanout2], oe = order_bounds[(size_t)(p + 1) * fanout2];
+                radix_refine(cust_pass1, cb, ce, shift2, bits2, cust_parts, cust_bounds + (size_t)p * fanout2);
+                radix_refine(order_pass1, ob, oe, shift2, bits2, order_parts, order_bounds + (size_t)p * fanout2);
+            }
+
+            #pragma omp single
+            {
+                free(cust_pass1);
+                free(order_pass1);
+                cust_pass1 = NULL;
+                order_pass1 = NULL;
+            }
+        }
+
+        // 가장 큰 Customer 파티션 크기 (스레드별 아레나 크기 산정)
+        int num_parts = 1 << (bits1 + bits2);
+        #pragma omp single
+        {
+            for (int p = 0; p < num_parts; p++) {
+                long count = cust_bounds[p + 1] - cust_bounds[p];
+                if (count > max_part_customers) {
+                    max_part_customers = count;
+                }
+            }
+        }
+
+        // ========================================
+        // 2.5 파티션별 조인: 캐시에 들어가는 테이블을 구축하고 같은 파티션의 Order로 탐색
+        // ========================================
+        Arena *arena = failed ? NULL : arena_create(hash_table_arena_bytes(max_part_customers));
+        if (!failed && !arena) {
+            fprintf(stderr, "[Thread %d] 아레나 할당 실패\n", thread_id);
+            __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+        }
+
+        #pragma omp barrier
+
+        if (!failed) {
+            #pragma omp for schedule(dynamic, 4) nowait
+            for (int p = 0; p < num_parts; p++) {
+                long cb = cust_bounds[p], ce = cust_bounds[p + 1];
+                long ob = order_bounds[p], oe = order_bounds[p + 1];
+                if (cb == ce || ob == oe) {
+                    continue;  // 한쪽이 비면 매칭 없음
+                }
+
+                arena_reset(arena);
+                HashTable *table = hash_table_create(arena, ce - cb);
+                if (!table) {
+                    __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+                    continue;
+                }
+                for (long j = cb; j < ce; j++) {
+                    hash_table_insert(table, cust_parts[j].key, (int32_t)(j - cb));
+                }
+
+                OrderRecord order;
+                for (long j = ob; j < oe && !__atomic_load_n(&failed, __ATOMIC_RELAXED); j++) {
+                    long key = order_parts[j].key;
+                    size_t pos = hash_table_slot(table, key);
+                    int materialized = 0;
+                    int32_t idx;
+                    while ((idx = hash_table_next(table, key, &pos)) >= 0) {
+                        if (!materialized) {
+                            // 매칭된 Order만 행 위치에서 전체 컬럼을 다시 읽음 (실패하면 결과에 넣지 않음)
+                            if (!disk_reader_read_order_at(order_reader, order_parts[j].payload, &order)) {
+                                fprintf(stderr, "[Thread %d] Order 행 다시 읽기 실패 (위치 %ld)\n",
+                                        thread_id, order_parts[j].payload);
+                                __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+                                break;
+                            }
+                            materialized = 1;
+                        }
+                        result_buffer_add(result_buf, &customers[cust_parts[cb + idx].payload], &order);
+                        result_count++;
+                    }
+                }
+            }
+            printf("[Thread %d] 완료: %ld건 매칭 및 저장\n", thread_id, result_count);
+        }
+
+        // ========================================
+        // 2.6 스레드별 통계 및 리소스 정리
+        // ========================================
+        DiskReaderStats thread_stats = {0};
+        DiskReaderStats reader_stats;
+        char label[64];
+        if (cust_reader) {
+            disk_reader_get_stats(cust_reader, &reader_stats);
+            snprintf(label, sizeof(label), "[Thread %d] Customer: ", thread_id);
+            disk_reader_stats_print(label, &reader_stats);
+            disk_reader_stats_merge(&thread_stats, &reader_stats);
+        }
+        if (order_reader) {
+            disk_reader_get_stats(order_reader, &reader_stats);
+            snprintf(label, sizeof(label), "[Thread %d] Orders:   ", thread_id);
+            disk_reader_stats_print(label, &reader_stats);
+            disk_reader_stats_merge(&thread_stats, &reader_stats);
+        }
+        if (stats) {
+            #pragma omp critical(join_stats)
+            disk_reader_stats_merge(stats, &thread_stats);
+        }
+
+        arena_destroy(arena);
+        if (result_buf) result_buffer_destroy(result_buf);
+        free(order_buffer);
+        if (cust_reader) disk_reader_close(cust_reader);
+        if (order_reader) disk_reader_close(order_reader);
+
+        total_result += result_count;
+    }
+
+    // ========================================
+    // 3. 공유 메모리 해제 및 결과 파일 마무리
+    // ========================================
+    if (cust_parts != cust_pass1) free(cust_parts);
+    if (order_parts != order_pass1) free(order_parts);
+    free(cust_pass1);
+    free(order_pass1);
+    free(customers);
+    free(cust_offset);
+    free(order_offset);
+    free(cust_hist);
+    free(order_hist);
+    free(cust_bounds);
+    free(order_bounds);
+    if (failed) {
+        fprintf(stderr, "기수 분할 조인 실패\n");
+        return -1;
+    }
+
+    disk_save_finalize(output_file, total_result);
+
+    printf("\n병렬 처리 완료 (기수 분할 버전)!\n");
+    return total_result;
+}
+
+// ========================================
+// 하이브리드 해시 조인 (메모리 예산 + 디스크 스필, 결과 저장)
+// - 키 해시 상위 비트로 두 테이블을 num_parts개 파티션으로 나눔
+// - 파티션 0: Customer를 메모리의 공유 해시 테이블에 올리고 Order 스캔 중 바로 탐색
+// - 나머지 파티션: Customer/Order를 이진 레코드로 임시 파일에 스필한 뒤
+//   파티션 하나씩(스레드마다 하나) 메모리에 올려 조인
+// → 예산이 작아도 입력은 최대 한 번 읽고 + 스필 파일 한 번 쓰고 읽음 (Orders 반복 스캔 없음)
+// ========================================
+
+#define HYBRID_MAX_PARTS 256  // 스필 파일 수 상한 (테이블당, 파일 디스크립터 수 제한)
+
+// 스레드 수만큼의 파티션이 동시에 메모리에 올라가도 예산 안에 들어가는 파티션 수
+static int hybrid_partition_count(size_t build_bytes, size_t memory_budget, int num_threads) {
+    int parts = 2;
+    while (parts < HYBRID_MAX_PARTS &&
+           (double)build_bytes / parts * num_threads > (double)memory_budget) {
+        parts *= 2;
+    }
+    return parts;
+}
+
+long disk_parallel_hybrid_hash_join_save(const char *customer_file, const char *order_file,
+                                         int block_size, size_t memory_budget, const char *output_file,
+                                         int num_threads, DiskReaderStats *stats) {
+    // ========================================
+    // 1. 출력 파일/스필 파일 준비
+    // ========================================
+    if (disk_save_init(output_file) != 0) {
+        fprintf(stderr, "출력 파일 초기화 실패\n");
+        return -1;
+    }
+
+    size_t build_bytes = join_estimate_build_bytes(customer_file);
+    int num_parts = hybrid_partition_count(build_bytes, memory_budget, num_threads);
+    int part_bits = 0;
+    while ((1 << part_bits) < num_parts) {
+        part_bits++;
+    }
+    int part_shift = 64 - part_bits;
+
+    // 파티션당 스필 버퍼: 스레드 × 파티션 × 2(두 테이블) 버퍼가 예산의 1/8 이내
+    size_t spill_buffer = memory_budget / ((size_t)8 * num_threads * num_parts * 2);
+    if (spill_buffer < SPILL_BUFFER_MIN) spill_buffer = SPILL_BUFFER_MIN;
+    if (spill_buffer > SPILL_BUFFER_MAX) spill_buffer = SPILL_BUFFER_MAX;
+
+    printf("%d개 스레드로 병렬 처리 시작 (하이브리드 해시 조인)...\n", num_threads);
+    printf("파티션 %d개 (0번은 메모리, 나머지는 스필), 스필 버퍼 %zu KB\n", num_parts, spill_buffer / 1024);
+    printf("출력 파일: %s\n\n", output_file);
+
+    char spill_dir[256];
+    if (spill_make_dir(spill_dir, sizeof(spill_dir)) != 0) {
+        return -1;
+    }
+    SpillFile *cust_spill = (SpillFile *)calloc(num_parts, sizeof(SpillFile));
+    SpillFile *order_spill = (SpillFile *)calloc(num_parts, sizeof(SpillFile));
+    long *part_offset = (long *)calloc(num_threads + 1, sizeof(long));
+    int failed = 0;
+    if (!cust_spill || !order_spill || !part_offset) {
+        fprintf(stderr, "스필 파일 배열 할당 실패\n");
+        failed = 1;
+    }
+    for (int p = 0; !failed && p < num_parts; p++) {
+        cust_spill[p].fd = -1;
+        order_spill[p].fd = -1;
+    }
+    for (int p = 1; !failed && p < num_parts; p++) {
+        if (spill_open(&cust_spill[p], spill_dir, "customer", p) != 0 ||
+            spill_open(&order_spill[p], spill_dir, "order", p) != 0) {
+            failed = 1;
+        }
+    }
+
+    CustomerRecord *customers = NULL;  // 파티션 0 Customer (공유 빌드 입력)
+    Arena *arena = NULL;
+    HashTable *hash_table = NULL;
+    long total_result = 0;
+    long spilled_bytes = 0;
+
+    // ========================================
+    // 2. OpenMP 병렬 처리 영역 (단계 사이는 배리어로 동기화)
+    // ========================================
+    #pragma omp parallel num_threads(num_threads) reduction(+:total_result, spilled_bytes)
+    {
+        int i = omp_get_thread_num();
+        int thread_id = i + 1;
+        long result_count = 0;
+
+        DiskReader *cust_reader = disk_reader_open(customer_file, "customer", block_size);
+        DiskReader *order_reader = disk_reader_open(order_file, "order", block_size);
+        int max_cust_records = block_size / sizeof(CustomerRecord);
+        int max_order_records = block_size / sizeof(OrderRecord);
+        CustomerRecord *cust_buffer = (CustomerRecord *)malloc(sizeof(CustomerRecord) * max_cust_records);
+        OrderRecord *order_buffer = (OrderRecord *)malloc(sizeof(OrderRecord) * max_order_records);
+        ResultBuffer *result_buf = result_buffer_create(output_file, 10000);
+        SpillWriter *cust_writer = spill_writer_create(cust_spill, num_parts, sizeof(CustomerRecord), spill_buffer);
+        SpillWriter *order_writer = spill_writer_create(order_spill, num_parts, sizeof(OrderRecord), spill_buffer);
+        if (!cust_reader || !order_reader || !cust_buffer || !order_buffer || !result_buf ||
+            !cust_writer || !order_writer) {
+            fprintf(stderr, "[Thread %d] 리소스 할당 실패\n", thread_id);
+            __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+        }
+
+        // ========================================
+        // 2.1 Customer 분할: 파티션 0은 메모리, 나머지는 스필
+        // ========================================
+        CustomerRecord *local = NULL;
+        long local_count = 0, local_capacity = 0;
+        if (!failed) {
+            disk_reader_set_partition(cust_reader, i, num_threads);
+            int n;
+            while (disk_reader_read_customers_batch(cust_reader, cust_buffer, max_cust_records, &n)) {
+                for (int j = 0; j < n; j++) {
+                    int part = radix_digit(cust_buffer[j].custkey, part_shift, part_bits);
+                    if (part != 0) {
+                        if (spill_writer_add(cust_writer, part, &cust_buffer[j]) != 0) {
+                            __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+                        }
+                    } else if (reserve_customers(&local, &local_capacity, local_count + 1)) {
+                        local[local_count++] = cust_buffer[j];
+                    } else {
+                        __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+                    }
+                }
+            }
+            if (spill_writer_flush(cust_writer) != 0) {
+                __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+            }
+        }
+        part_offset[i + 1] = local_count;
+
+        #pragma omp barrier
+
+        // ========================================
+        // 2.2 파티션 0 공유 해시 테이블 구축
+        // ========================================
+        #pragma omp single
+        if (!failed) {
+            for (int t = 0; t < num_threads; t++) {
+                part_offset[t + 1] += part_offset[t];
+            }
+            long total = part_offset[num_threads];
+            customers = (CustomerRecord *)malloc(sizeof(CustomerRecord) * (total ? total : 1));
+            arena = arena_create(hash_table_arena_bytes(total));
+            hash_table = arena ? hash_table_create(arena, total) : NULL;
+            if (!customers || !hash_table) {
+                fprintf(stderr, "파티션 0 빌드 메모리 할당 실패\n");
+                failed = 1;
+            }
+        }
+
+        if (!failed) {
+            long begin = part_offset[i];
+            memcpy(customers + begin, local, sizeof(CustomerRecord) * local_count);
+            for (long j = 0; j < local_count; j++) {
+                hash_table_insert_atomic(hash_table, local[j].custkey, (int32_t)(begin + j));
+            }
+        }
+        free(local);
+
+        #pragma omp barrier
+
+        // ========================================
+        // 2.3 Order 분할 스캔: 파티션 0은 바로 탐색, 나머지는 전체 컬럼을 파싱해 스필
+        // ========================================
+        if (!failed) {
+            disk_reader_set_partition(order_reader, i, num_threads);
+            disk_reader_set_columns(order_reader, ORDER_COL_CUSTKEY);
+
+            int order_count;
+            while (disk_reader_read_orders_batch(order_reader, order_buffer, max_order_records, &order_count)) {
+                for (int j = 0; j < order_count; j++) {
+                    long key = order_buffer[j].custkey;
+                    int part = radix_digit(key, part_shift, part_bits);
+                    if (part != 0) {
+                        disk_reader_materialize_order(order_reader, j, &order_buffer[j]);
+                        if (spill_writer_add(order_writer, part, &order_buffer[j]) != 0) {
+                            __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+                        }
+                        continue;
+                    }
+
+                    size_t pos = hash_table_slot(hash_table, key);
+                    int materialized = 0;
+                    int32_t idx;
+                    while ((idx = hash_table_next(hash_table, key, &pos)) >= 0) {
+                        if (!materialized) {
+                            disk_reader_materialize_order(order_reader, j, &order_buffer[j]);
+                            materialized = 1;
+                        }
+                        result_buffer_add(result_buf, &customers[idx], &order_buffer[j]);
+                        result_count++;
+                    }
+                }
+            }
+            if (spill_writer_flush(order_writer) != 0) {
+                __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+            }
+        }
+        if (cust_writer && order_writer) {
+            spilled_bytes += cust_writer->written + order_writer->written;
+        }
+
+        #pragma omp barrier
+
+        // 파티션 0 조인은 끝났으므로 스필 파티션을 올리기 전에 해제
+        // (예산은 스레드마다 파티션 하나씩, 동시에 num_threads개만 메모리에 있다고 가정)
+        #pragma omp single
+        {
+            free(customers);
+            customers = NULL;
+            arena_destroy(arena);
+            arena = NULL;
+            hash_table = NULL;
+        }
+
+        // ========================================
+        // 2.4 스필 파티션 조인: 스레드마다 파티션 하나씩 Customer를 올려 테이블 구축 후 Order 스트리밍
+        // ========================================
+        if (!failed) {
+            #pragma omp for schedule(dynamic) nowait
+            for (int p = 1; p < num_parts; p++) {
+                long cust_bytes = spill_size(&cust_spill[p]);
+                long count = cust_bytes / (long)sizeof(CustomerRecord);
+                if (count <= 0) {
+                    continue;  // Customer가 없으면 매칭 없음
+                }
+
+                CustomerRecord *part_customers = (CustomerRecord *)malloc(sizeof(CustomerRecord) * count);
+                Arena *part_arena = arena_create(hash_table_arena_bytes(count));
+                HashTable *part_table = part_arena ? hash_table_create(part_arena, count) : NULL;
+                if (!part_customers || !part_table ||
+                    spill_read(&cust_spill[p], part_customers, sizeof(CustomerRecord) * count, 0) !=
+                        (ssize_t)(sizeof(CustomerRecord) * count)) {
+                    fprintf(stderr, "[Thread %d] 파티션 %d 로드 실패\n", thread_id, p);
+                    __atomic_store_n(&failed, 1, __ATOMIC_RELAXED);
+                    free(part_customers);
+                    arena_destroy(part_arena);
+                    continue;
+                }
+                for (long j = 0; j < count; j++) {
+                    hash_table_insert(part_table, part_customers[j].custkey, (int32_t)j);
+                }
+
+                // Order 스필 파일을 블록 단위로 읽으며 탐색
+                long offset = 0;
+                ssize_t got;
+                while ((got = spill_read(&order_spill[p], order_buffer,
+                                         sizeof(OrderRecord) * max_order_records, offset)) > 0) {
+                    int n = got / sizeof(OrderRecord);
+                    offset += (long)n * sizeof(OrderRecord);
+                    for (int j = 0; j < n; j++) {
+                        long key = order_buffer[j].custkey;
+                        size_t pos = hash_table_slot(part_table, key);
+                        int32_t idx;
+                        while ((idx = hash_table_next(part_table, key, &pos)) >= 0) {
+                            result_buffer_add(result_buf, &part_customers[idx], &order_buffer[j]);
+                            result_count++;
+                        }
+                    }
+                    if (n == 0) {
+                        break;
+                    }
+                }
+
+                free(part_customers);
+                arena_destroy(part_arena);
+            }
+            printf("[Thread %d] 완료: %ld건 매칭 및 저장\n", thread_id, result_count);
+        }
+
+        // ========================================
+        // 2.5 스레드별 통계 및 리소스 정리
+        // ========================================
+        DiskReaderStats thread_stats = {0};
+        DiskReaderStats reader_stats;
+        char label[64];
+        if (cust_reader) {
+            disk_reader_get_stats(cust_reader, &reader_stats);
+            snprintf(label, sizeof(label), "[Thread %d] Customer: ", thread_id);
+            disk_reader_stats_print(label, &reader_stats);
+            disk_reader_stats_merge(&thread_stats, &reader_stats);
+        }
+        if (order_reader) {
+            disk_reader_get_stats(order_reader, &reader_stats);
+            snprintf(label, sizeof(label), "[Thread %d] Orders:   ", thread_id);
+            disk_reader_stats_print(label, &reader_stats);
+            disk_reader_stats_merge(&thread_stats, &reader_stats);
+        }
+        if (stats) {
+            #pragma omp critical(join_stats)
+            disk_reader_stats_merge(stats, &thread_stats);
+        }
+
+        spill_writer_destroy(cust_writer);
+        spill_writer_destroy(order_writer);
+        if (result_buf) result_buffer_destroy(result_buf);
         free(cust_buffer);
         free(order_buffer);
-        disk_reader_close(cust_reader);
-        disk_reader_close(order_reader);
+        if (cust_reader) disk_reader_close(cust_reader);
+        if (order_reader) disk_reader_close(order_reader);
 
         total_result += result_count;
     }
 
     // ========================================
-    // 4. 최종 결과 파일 마무리
+    // 3. 스필 파일/공유 메모리 정리 및 결과 파일 마무리
     // ========================================
-    // 출력 파일에 통계 정보 추가 및 최종 정리
+    for (int p = 0; cust_spill && order_spill && p < num_parts; p++) {
+        spill_close(&cust_spill[p]);
+        spill_close(&order_spill[p]);
+    }
+    spill_remove_dir(spill_dir);
+    free(cust_spill);
+    free(order_spill);
+    free(part_offset);
+    free(customers);
+    arena_destroy(arena);
+    if (failed) {
+        fprintf(stderr, "하이브리드 해시 조인 실패\n");
+        return -1;
+    }
+
+    printf("스필: %.1f MB (파티션 %d개 중 %d개)\n", spilled_bytes / (1024.0 * 1024.0), num_parts, num_parts - 1);
     disk_save_finalize(output_file, total_result);
 
-    printf("\n병렬 처리 완료 (결과 저장 버전)!\n");
+    printf("\n병렬 처리 완료 (하이브리드 버전)!\n");
     return total_result;
 }
+
+// ========================================
+// 조인 방식 선택
+// - 자동(auto): Customer 앞부분을 샘플링해 전체 레코드 수를 추정하고
+//   공유 빌드에 필요한 메모리(레코드 배열 + 테이블)가 예산 안이면 공유 빌드, 아니면 하이브리드 조인
+// - 그 외에는 지정한 방식으로 실행
+// ========================================
+
+const char* join_algorithm_name(JoinAlgorithm algorithm) {
+    switch (algorithm) {
+        case JOIN_ALGORITHM_BLOCK:  return "block";
+        case JOIN_ALGORITHM_SHARED: return "shared";
+        case JOIN_ALGORITHM_RADIX:  return "radix";
+        case JOIN_ALGORITHM_HYBRID: return "hybrid";
+        default:                    return "auto";
+    }
+}
+
+#define BUILD_SAMPLE_BYTES (64 * 1024)
+
+// 파일 앞 BUILD_SAMPLE_BYTES의 평균 줄 길이로 전체 줄 수 추정 (실패 시 -1)
+static long estimate_rows(const char *filename) {
+    struct stat st;
+    if (stat(filename, &st) != 0) {
+        perror("stat");
+        return -1;
+    }
+    FILE *fp = fopen(filename, "r");
+    if (!fp) {
+        perror("fopen");
+        return -1;
+    }
+
+    char sample[BUILD_SAMPLE_BYTES];
+    size_t n = fread(sample, 1, sizeof(sample), fp);
+    fclose(fp);
+
+    long lines = 0;
+    for (const char *p = sample; (p = memchr(p, '\n', sample + n - p)) != NULL; p++) {
+        lines++;
+    }
+    if (lines == 0) {
+        return n > 0 ? 1 : 0;
+    }
+    return (long)((double)st.st_size * lines / n) + 1;
+}
+
+size_t join_estimate_build_bytes(const char *customer_file) {
+    long rows = estimate_rows(customer_file);
+    if (rows < 0) {
+        return (size_t)-1;
+    }
+    // 레코드 배열 + 스레드 로컬 사본(복사 중 일시적으로 2배) + 공유 테이블
+    return sizeof(CustomerRecord) * rows * 2 + hash_table_arena_bytes(rows) + direct_table_arena_bytes(rows);
+}
+
+long disk_parallel_join_save(const char *customer_file, const char *order_file,
+                             int block_size, size_t memory_budget, JoinAlgorithm algorithm,
+                             const char *output_file, int num_threads, DiskReaderStats *stats) {
+    switch (algorithm) {
+        case JOIN_ALGORITHM_BLOCK:
+            printf("조인 방식: 블록 조인 (지정)\n");
+            return disk_parallel_block_nested_loop_join_hash_save(customer_file, order_file, block_size,
+                                                                  output_file, num_threads, stats);
+        case JOIN_ALGORITHM_SHARED:
+            printf("조인 방식: 공유 빌드 (지정)\n");
+            return disk_parallel_shared_hash_join_save(customer_file, order_file, block_size,
+                                                       output_file, num_threads, stats);
+        case JOIN_ALGORITHM_RADIX:
+            printf("조인 방식: 기수 분할 (지정)\n");
+            return disk_parallel_radix_hash_join_save(customer_file, order_file, block_size,
+                                                      output_file, num_threads, stats);
+        case JOIN_ALGORITHM_HYBRID:
+            printf("조인 방식: 하이브리드 (지정)\n");
+            return disk_parallel_hybrid_hash_join_save(customer_file, order_file, block_size, memory_budget,
+                                                       output_file, num_threads, stats);
+        default:
+            break;
+    }
+
+    size_t build_bytes = join_estimate_build_bytes(customer_file);
+
+    if (build_bytes <= memory_budget) {
+        printf("조인 방식: 공유 빌드 (예상 빌드 메모리 %.1f MB <= 예산 %.1f MB)\n",
+               build_bytes / (1024.0 * 1024.0), memory_budget / (1024.0 * 1024.0));
+        return disk_parallel_shared_hash_join_save(customer_file, order_file, block_size,
+                                                   output_file, num_threads, stats);
+    }
+
+    printf("조인 방식: 하이브리드 (예상 빌드 메모리 %.1f MB > 예산 %.1f MB)\n",
+           build_bytes / (1024.0 * 1024.0), memory_budget / (1024.0 * 1024.0));
+    return disk_parallel_hybrid_hash_join_save(customer_file, order_file, block_size, memory_budget,
+                                               output_file, num_threads, stats);
+}
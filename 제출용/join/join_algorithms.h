@@ -2,14 +2,16 @@
 #define JOIN_ALGORITHMS_H
 
 #include <pthread.h>
+#include "disk_reader.h"
 
-typedef struct HashNode {
-    long custkey;
-    int customer_idx;
-    struct HashNode *next;
-} HashNode;
-
-#define HASH_SIZE 100003
+// 조인 방식
+typedef enum {
+    JOIN_ALGORITHM_AUTO = 0,    // 메모리 예산에 따라 공유 빌드 또는 하이브리드 조인
+    JOIN_ALGORITHM_BLOCK = 1,   // 블록 해시 조인 (스레드별 Orders 반복 스캔)
+    JOIN_ALGORITHM_SHARED = 2,  // 공유 빌드 + 병렬 프로브
+    JOIN_ALGORITHM_RADIX = 3,   // 병렬 기수 분할 해시 조인
+    JOIN_ALGORITHM_HYBRID = 4   // 하이브리드 해시 조인 (예산 초과분은 디스크 스필)
+} JoinAlgorithm;
 
 typedef struct {
     const char *customer_file;
@@ -23,7 +25,34 @@ typedef struct {
 } ThreadArg;
 
 // 결과를 디스크에 저장하는 버전 (유일하게 사용되는 함수)
+// stats가 NULL이 아니면 모든 스레드의 리더 통계를 합산해 돌려줌
 long disk_parallel_block_nested_loop_join_hash_save(const char *customer_file, const char *order_file, 
-                                                     int block_size, const char *output_file, int num_threads);
+                                                     int block_size, const char *output_file, int num_threads,
+                                                     DiskReaderStats *stats);
+
+// 공유 빌드 + 병렬 프로브 버전 (Customer 전체를 메모리에 올리고 Order는 한 번만 스캔)
+long disk_parallel_shared_hash_join_save(const char *customer_file, const char *order_file,
+                                         int block_size, const char *output_file, int num_threads,
+                                         DiskReaderStats *stats);
+
+// 병렬 기수 분할 버전 (두 테이블을 캐시 크기 파티션으로 나눠 파티션별로 조인)
+long disk_parallel_radix_hash_join_save(const char *customer_file, const char *order_file,
+                                        int block_size, const char *output_file, int num_threads,
+                                        DiskReaderStats *stats);
+
+// 하이브리드 해시 조인 버전 (파티션 0만 메모리에서 조인, 나머지 파티션은 임시 파일에 스필 후 하나씩 조인)
+long disk_parallel_hybrid_hash_join_save(const char *customer_file, const char *order_file,
+                                         int block_size, size_t memory_budget, const char *output_file,
+                                         int num_threads, DiskReaderStats *stats);
+
+// 공유 빌드에 필요한 메모리 추정치 (Customer 파일 샘플링)
+size_t join_estimate_build_bytes(const char *customer_file);
+
+const char* join_algorithm_name(JoinAlgorithm algorithm);
+
+// algorithm으로 실행 (AUTO: 빌드 측이 memory_budget 안에 들어가면 공유 빌드, 아니면 하이브리드 조인)
+long disk_parallel_join_save(const char *customer_file, const char *order_file,
+                             int block_size, size_t memory_budget, JoinAlgorithm algorithm,
+                             const char *output_file, int num_threads, DiskReaderStats *stats);
 
 #endif
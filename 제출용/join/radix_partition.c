@@ -0,0 +1,38 @@
+#include "radix_partition.h"
+
+// ========================================
+// 기수 분할 모듈 (Radix Partition Module)
+// - 히스토그램 → 접두 합으로 파티션 시작 위치 계산 → 흩뿌리기 순서로 사용
+// - 병렬 분할은 스레드별 히스토그램의 접두 합으로 각자 쓰기 위치를 나눠 가짐 (잠금 없음)
+// ========================================
+
+int radix_partition_bits(long build_count, size_t table_bytes_per_key) {
+    int bits = 0;
+    while (bits < RADIX_MAX_BITS &&
+           (double)build_count * table_bytes_per_key / ((size_t)1 << bits) > RADIX_CACHE_BYTES) {
+        bits++;
+    }
+    return bits;
+}
+
+void radix_histogram(const JoinTuple *in, long n, int shift, int bits, long *hist) {
+    if (bits == 0) {
+        hist[0] += n;
+        return;
+    }
+    for (long i = 0; i < n; i++) {
+        hist[radix_digit(in[i].key, shift, bits)]++;
+    }
+}
+
+void radix_scatter(const JoinTuple *in, long n, int shift, int bits, long *cursor, JoinTuple *out) {
+    if (bits == 0) {
+        for (long i = 0; i < n; i++) {
+            out[cursor[0]++] = in[i];
+        }
+        return;
+    }
+    for (long i = 0; i < n; i++) {
+        out[cursor[radix_digit(in[i].key, shift, bits)]++] = in[i];
+    }
+}
@@ -0,0 +1,43 @@
+#ifndef RADIX_PARTITION_H
+#define RADIX_PARTITION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ========================================
+// 기수 분할 (Radix Partitioning)
+// - (키, 페이로드) 튜플을 키 해시의 상위 비트로 여러 파티션에 나눔
+// - 파티션 하나의 빌드 테이블이 L2 캐시에 들어가도록 분할 비트 수 결정
+// - 한 패스의 팬아웃은 RADIX_PASS_BITS로 제한 (TLB/쓰기 버퍼 미스 방지) → 필요하면 2패스
+// ========================================
+
+#define RADIX_PASS_BITS 8                     // 패스당 최대 분할 비트 (팬아웃 256)
+#define RADIX_MAX_BITS (2 * RADIX_PASS_BITS)  // 최대 2패스
+#define RADIX_CACHE_BYTES (256 * 1024)        // 파티션 빌드 테이블 목표 크기 (L2)
+
+typedef struct {
+    long key;
+    long payload;           // Customer: 공유 배열 인덱스, Order: 행 위치 (disk_reader_order_locator)
+} JoinTuple;
+
+// 키 해시 (상위 비트를 파티션 번호로 사용)
+static inline uint64_t radix_hash(long key) {
+    return (uint64_t)key * 0x9E3779B97F4A7C15ULL;
+}
+
+// 해시 상위 shift 이후 bits비트 = 파티션 번호 (shift = 64 - 지금까지 사용한 비트 수)
+static inline uint32_t radix_digit(long key, int shift, int bits) {
+    return (uint32_t)(radix_hash(key) >> shift) & ((1u << bits) - 1);
+}
+
+// 빌드 측 build_count개가 파티션마다 table_bytes_per_key 바이트씩 쓸 때
+// 파티션 테이블이 RADIX_CACHE_BYTES 안에 들어가도록 하는 총 분할 비트 수
+int radix_partition_bits(long build_count, size_t table_bytes_per_key);
+
+// in[0..n)의 파티션별 개수를 hist[0..2^bits)에 더함
+void radix_histogram(const JoinTuple *in, long n, int shift, int bits, long *hist);
+
+// in[0..n)을 파티션별 쓰기 위치 cursor[0..2^bits)에 흩뿌림 (cursor는 쓴 만큼 증가)
+void radix_scatter(const JoinTuple *in, long n, int shift, int bits, long *cursor, JoinTuple *out);
+
+#endif
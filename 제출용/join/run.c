@@ -1,18 +1,32 @@
 #include <stdio.h>
 #include <time.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/time.h>
 #include "join_algorithms.h"
 #include "disk_reader.h"
+#include "column_cache.h"
+#include "hash_table.h"
+#include "bloom_filter.h"
+#include "zone_map.h"
+
+#define MIN_BLOCK_MB 1
+#define MAX_BLOCK_MB 256
 
 int main(int argc, char *argv[]) {
     const char *customer_file = "../tbl/customer.tbl";
     const char *order_file = "../tbl/orders.tbl";
     const char *output_file = "./join_results.txt";
-    int block_size_mb = 190;  // 기본 블록 크기 (MB)
+    long memory_budget_mb = 1536;  // 기본 메모리 예산 (MB)
     int num_threads = 8;  // 기본값
+    DiskReaderMode io_mode = DISK_READER_MODE_MMAP;  // 기본 입력 방식
+    double load_factor = HASH_TABLE_DEFAULT_LOAD_FACTOR;  // 해시 테이블 목표 적재율
+    JoinAlgorithm algorithm = JOIN_ALGORITHM_AUTO;  // 조인 방식
+    BloomFilterMode bloom_mode = BLOOM_FILTER_AUTO;  // 블록 조인의 블룸 필터 사용 방식
+    const char *date_range = "all";  // 주문 날짜 조건 (all: 조건 없음)
     
-    // 명령줄 인자로 스레드 수와 블록 크기(MB) 받기 (선택적)
+    // 명령줄 인자로 스레드 수, 메모리 예산(MB), 입력 방식, 해시 적재율, 조인 방식, 블룸 필터,
+    // 주문 날짜 조건 받기 (선택적)
     if (argc > 1) {
         num_threads = atoi(argv[1]);
         if (num_threads <= 0 || num_threads > 32) {
@@ -21,15 +35,102 @@ int main(int argc, char *argv[]) {
         }
     }
     if (argc > 2) {
-        block_size_mb = atoi(argv[2]);
-        if (block_size_mb <= 0) {
-            fprintf(stderr, "유효하지 않은 블록 크기: %d (양수로 지정)\n", block_size_mb);
+        memory_budget_mb = atol(argv[2]);
+        if (memory_budget_mb <= 0) {
+            fprintf(stderr, "유효하지 않은 메모리 예산: %ld (양수로 지정)\n", memory_budget_mb);
+            return 1;
+        }
+    }
+    if (argc > 3) {
+        if (strcmp(argv[3], "mmap") == 0) {
+            io_mode = DISK_READER_MODE_MMAP;
+        } else if (strcmp(argv[3], "fread") == 0) {
+            io_mode = DISK_READER_MODE_FREAD;
+        } else if (strcmp(argv[3], "columnar") == 0) {
+            io_mode = DISK_READER_MODE_COLUMNAR;
+        } else if (strcmp(argv[3], "direct") == 0) {
+            io_mode = DISK_READER_MODE_DIRECT;
+        } else {
+            fprintf(stderr, "유효하지 않은 입력 방식: %s (mmap, fread, columnar, direct)\n", argv[3]);
             return 1;
         }
     }
+    if (argc > 4) {
+        load_factor = atof(argv[4]);
+        if (load_factor < 0.05 || load_factor > 0.95) {
+            fprintf(stderr, "유효하지 않은 해시 적재율: %s (0.05-0.95 사이로 지정)\n", argv[4]);
+            return 1;
+        }
+    }
+    hash_table_set_default_load_factor(load_factor);
+    if (argc > 5) {
+        if (strcmp(argv[5], "auto") == 0) {
+            algorithm = JOIN_ALGORITHM_AUTO;
+        } else if (strcmp(argv[5], "block") == 0) {
+            algorithm = JOIN_ALGORITHM_BLOCK;
+        } else if (strcmp(argv[5], "shared") == 0) {
+            algorithm = JOIN_ALGORITHM_SHARED;
+        } else if (strcmp(argv[5], "radix") == 0) {
+            algorithm = JOIN_ALGORITHM_RADIX;
+        } else if (strcmp(argv[5], "hybrid") == 0) {
+            algorithm = JOIN_ALGORITHM_HYBRID;
+        } else {
+            fprintf(stderr, "유효하지 않은 조인 방식: %s (auto, block, shared, radix, hybrid)\n", argv[5]);
+            return 1;
+        }
+    }
+    if (argc > 6) {
+        if (strcmp(argv[6], "auto") == 0) {
+            bloom_mode = BLOOM_FILTER_AUTO;
+        } else if (strcmp(argv[6], "on") == 0) {
+            bloom_mode = BLOOM_FILTER_ON;
+        } else if (strcmp(argv[6], "off") == 0) {
+            bloom_mode = BLOOM_FILTER_OFF;
+        } else {
+            fprintf(stderr, "유효하지 않은 블룸 필터 설정: %s (auto, on, off)\n", argv[6]);
+            return 1;
+        }
+    }
+    bloom_filter_set_mode(bloom_mode);
+    if (argc > 7) {
+        // "YYYY-MM-DD..YYYY-MM-DD" (양 끝 포함): 범위 밖 Order는 조인에 참여하지 않음
+        date_range = argv[7];
+        if (strcmp(date_range, "all") != 0) {
+            const char *sep = strstr(date_range, "..");
+            int date_min = sep ? zone_map_parse_date(date_range, sep) : 0;
+            int date_max = sep ? zone_map_parse_date(sep + 2, sep + 2 + strlen(sep + 2)) : 0;
+            if (date_min < 10000101 || date_max < date_min) {
+                fprintf(stderr, "유효하지 않은 주문 날짜 조건: %s (YYYY-MM-DD..YYYY-MM-DD 또는 all)\n", date_range);
+                return 1;
+            }
+            disk_reader_set_default_date_filter(date_min, date_max);
+        }
+    }
+
+    // 컬럼 캐시 모드: 캐시가 없거나 원본이 바뀌었으면 조인 전에 한 번 생성
+    if (io_mode == DISK_READER_MODE_COLUMNAR) {
+        if (column_cache_prepare(customer_file, COLUMN_TABLE_CUSTOMER) != 0 ||
+            column_cache_prepare(order_file, COLUMN_TABLE_ORDER) != 0) {
+            fprintf(stderr, "컬럼 캐시 준비 실패, mmap 모드로 실행합니다\n");
+            io_mode = DISK_READER_MODE_MMAP;
+        }
+    }
+    disk_reader_set_default_mode(io_mode);
+
+    // Orders 존 맵: 없거나 원본이 바뀌었으면 생성 (실패해도 청크 건너뛰기만 하지 않음)
+    if (zone_map_prepare(order_file) != 0) {
+        fprintf(stderr, "존 맵 준비 실패, 청크 건너뛰기 없이 실행합니다\n");
+    }
     
     // MB를 바이트로 변환
-    int block_size = block_size_mb * 1024 * 1024;
+    size_t memory_budget = (size_t)memory_budget_mb * 1024 * 1024;
+
+    // I/O 블록 크기는 예산에서 유도: 스레드마다 리더 버퍼(이중 버퍼)와 레코드 버퍼로
+    // 블록 약 4개 분량을 쓰므로 예산 / (4 × 스레드 수), 1MB ~ MAX_BLOCK_MB 범위로 제한
+    size_t block_bytes = memory_budget / ((size_t)4 * num_threads);
+    if (block_bytes < (size_t)MIN_BLOCK_MB * 1024 * 1024) block_bytes = (size_t)MIN_BLOCK_MB * 1024 * 1024;
+    if (block_bytes > (size_t)MAX_BLOCK_MB * 1024 * 1024) block_bytes = (size_t)MAX_BLOCK_MB * 1024 * 1024;
+    int block_size = (int)block_bytes;
     
     printf("==============================================\n");
     printf("조인\n");
@@ -38,19 +139,25 @@ int main(int argc, char *argv[]) {
     printf("입력 파일:\n");
     printf("  - Customer: %s\n", customer_file);
     printf("  - Orders: %s\n", order_file);
-    printf("  - Block Size: %d MB\n", block_size_mb);
+    printf("  - 메모리 예산: %ld MB\n", memory_budget_mb);
+    printf("  - Block Size: %.1f MB\n", block_size / (1024.0 * 1024.0));
+    printf("  - 입력 방식: %s\n", disk_reader_mode_name(io_mode));
+    printf("  - 해시 적재율 목표: %.2f\n", load_factor);
+    printf("  - 조인 방식: %s\n", join_algorithm_name(algorithm));
+    printf("  - 블룸 필터 (블록 조인): %s\n", bloom_filter_mode_name(bloom_mode));
+    printf("  - 주문 날짜 조건: %s\n", date_range);
     printf("  - 병렬 스레드: %d개\n\n", num_threads);
     
-    // I/O 카운터 초기화
-    disk_reader_reset_io_count();
+    // 리더별 I/O/파싱 통계를 합산할 요약
+    DiskReaderStats io_stats = {0};
     
     // 시작 시간 기록 (실제 시간)
     struct timeval start_time, end_time;
     gettimeofday(&start_time, NULL);
     
     // JOIN 수행 및 결과 저장
-    long result_count = disk_parallel_block_nested_loop_join_hash_save(
-        customer_file, order_file, block_size, output_file, num_threads);
+    long result_count = disk_parallel_join_save(
+        customer_file, order_file, block_size, memory_budget, algorithm, output_file, num_threads, &io_stats);
     
     // 종료 시간 기록 (실제 시간)
     gettimeofday(&end_time, NULL);
@@ -60,7 +167,8 @@ int main(int argc, char *argv[]) {
     printf("\n==============================================\n");
     printf("실행 결과:\n");
     printf("  - 매칭된 레코드 수: %ld\n", result_count);
-    printf("  - 총 I/O 횟수: %ld\n", disk_reader_get_io_count());
+    printf("  - 총 I/O 횟수: %ld\n", io_stats.blocks);
+    disk_reader_stats_print("  - 입력 합계 (스레드 누적): ", &io_stats);
     printf("  - 실행 시간: %.2f초\n", elapsed);
     printf("  - 결과 파일: %s\n", output_file);
     printf("==============================================\n");
@@ -0,0 +1,152 @@
+#define _GNU_SOURCE  // mkdtemp
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "spill.h"
+
+// ========================================
+// 스필 파일 모듈 (Spill Module)
+// - 파티션 파일은 조인이 끝나면 삭제되고 임시 디렉터리도 제거됨
+// ========================================
+
+int spill_make_dir(char *dir, size_t dir_size) {
+    const char *base = getenv("TMPDIR");
+    if (!base || !*base) {
+        base = "/tmp";
+    }
+    snprintf(dir, dir_size, "%s/join_spill_XXXXXX", base);
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return -1;
+    }
+    return 0;
+}
+
+void spill_remove_dir(const char *dir) {
+    if (rmdir(dir) != 0) {
+        perror("rmdir");
+    }
+}
+
+int spill_open(SpillFile *file, const char *dir, const char *prefix, int part) {
+    snprintf(file->path, sizeof(file->path), "%s/%s_%d.bin", dir, prefix, part);
+    file->fd = open(file->path, O_RDWR | O_CREAT | O_TRUNC | O_APPEND, 0600);
+    if (file->fd < 0) {
+        perror("open");
+        return -1;
+    }
+    return 0;
+}
+
+void spill_close(SpillFile *file) {
+    if (file->fd >= 0) {
+        close(file->fd);
+        unlink(file->path);
+        file->fd = -1;
+    }
+}
+
+long spill_size(const SpillFile *file) {
+    struct stat st;
+    return fstat(file->fd, &st) == 0 ? (long)st.st_size : -1;
+}
+
+ssize_t spill_read(const SpillFile *file, void *buf, size_t len, long offset) {
+    size_t done = 0;
+    while (done < len) {
+        ssize_t got = pread(file->fd, (char *)buf + done, len - done, offset + done);
+        if (got < 0) {
+            if (errno == EINTR) continue;
+            perror("pread");
+            return -1;
+        }
+        if (got == 0) {
+            break;  // 파일 끝
+        }
+        done += got;
+    }
+    return done;
+}
+
+// buf 전체를 덧붙임 (O_APPEND: 한 번의 write 안에서는 다른 스레드 데이터와 섞이지 않음)
+static int append_all(SpillFile *file, const char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(file->fd, buf, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            perror("write");
+            return -1;
+        }
+        buf += n;
+        len -= n;
+    }
+    return 0;
+}
+
+SpillWriter* spill_writer_create(SpillFile *files, int num_parts, size_t record_size, size_t buffer_bytes) {
+    SpillWriter *writer = (SpillWriter *)malloc(sizeof(SpillWriter));
+    if (!writer) {
+        return NULL;
+    }
+
+    // 버퍼는 레코드 크기의 배수로 맞춰 레코드가 write 경계에서 잘리지 않게 함
+    if (buffer_bytes < record_size) {
+        buffer_bytes = record_size;
+    }
+    buffer_bytes -= buffer_bytes % record_size;
+
+    writer->files = files;
+    writer->num_parts = num_parts;
+    writer->record_size = record_size;
+    writer->buffer_bytes = buffer_bytes;
+    writer->buffers = (char *)malloc(buffer_bytes * num_parts);
+    writer->used = (size_t *)calloc(num_parts, sizeof(size_t));
+    writer->written = 0;
+    if (!writer->buffers || !writer->used) {
+        fprintf(stderr, "스필 버퍼 할당 실패\n");
+        spill_writer_destroy(writer);
+        return NULL;
+    }
+    return writer;
+}
+
+static int flush_part(SpillWriter *writer, int part) {
+    size_t used = writer->used[part];
+    if (used == 0) {
+        return 0;
+    }
+    writer->used[part] = 0;
+    writer->written += used;
+    return append_all(&writer->files[part], writer->buffers + writer->buffer_bytes * part, used);
+}
+
+int spill_writer_add(SpillWriter *writer, int part, const void *record) {
+    if (writer->used[part] + writer->record_size > writer->buffer_bytes && flush_part(writer, part) != 0) {
+        return -1;
+    }
+    memcpy(writer->buffers + writer->buffer_bytes * part + writer->used[part], record, writer->record_size);
+    writer->used[part] += writer->record_size;
+    return 0;
+}
+
+int spill_writer_flush(SpillWriter *writer) {
+    int result = 0;
+    for (int p = 0; p < writer->num_parts; p++) {
+        if (flush_part(writer, p) != 0) {
+            result = -1;
+        }
+    }
+    return result;
+}
+
+void spill_writer_destroy(SpillWriter *writer) {
+    if (writer) {
+        free(writer->buffers);
+        free(writer->used);
+        free(writer);
+    }
+}
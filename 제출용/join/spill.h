@@ -0,0 +1,53 @@
+#ifndef SPILL_H
+#define SPILL_H
+
+#include <stddef.h>
+#include <sys/types.h>
+
+// ========================================
+// 디스크 스필 파일 (Grace/하이브리드 해시 조인용)
+// - 파티션마다 임시 파일 하나를 O_APPEND로 열어 모든 스레드가 공유
+// - 스레드는 파티션별 버퍼에 고정 크기 레코드를 모았다가 write 한 번으로 덧붙임
+//   (O_APPEND 쓰기는 위치 결정이 원자적이므로 잠금 없이 레코드가 섞이지 않음)
+// ========================================
+
+#define SPILL_BUFFER_MIN (4 * 1024)
+#define SPILL_BUFFER_MAX (64 * 1024)
+
+typedef struct {
+    int fd;
+    char path[512];
+} SpillFile;
+
+// 파티션별 쓰기 버퍼 (스레드 전용)
+typedef struct {
+    SpillFile *files;       // 파티션별 스필 파일 (공유)
+    int num_parts;
+    size_t record_size;
+    size_t buffer_bytes;    // 파티션당 버퍼 크기 (record_size의 배수)
+    char *buffers;          // num_parts × buffer_bytes
+    size_t *used;           // 파티션별 버퍼 사용량
+    long written;           // 파일에 쓴 바이트 수
+} SpillWriter;
+
+// TMPDIR(없으면 /tmp) 아래에 임시 디렉터리 생성 (성공 0, 실패 -1)
+int spill_make_dir(char *dir, size_t dir_size);
+void spill_remove_dir(const char *dir);
+
+// dir/<prefix>_<part>.bin 파일을 읽기/쓰기(O_APPEND)로 생성 (성공 0, 실패 -1)
+int spill_open(SpillFile *file, const char *dir, const char *prefix, int part);
+// 파일을 닫고 삭제
+void spill_close(SpillFile *file);
+// 파일 크기 (바이트)
+long spill_size(const SpillFile *file);
+// offset부터 최대 len 바이트 읽기 (읽은 바이트 수, 실패 시 -1)
+ssize_t spill_read(const SpillFile *file, void *buf, size_t len, long offset);
+
+SpillWriter* spill_writer_create(SpillFile *files, int num_parts, size_t record_size, size_t buffer_bytes);
+// part 파티션에 레코드 하나 추가 (성공 0, 쓰기 실패 -1)
+int spill_writer_add(SpillWriter *writer, int part, const void *record);
+// 모든 파티션 버퍼를 파일에 기록 (성공 0, 실패 -1)
+int spill_writer_flush(SpillWriter *writer);
+void spill_writer_destroy(SpillWriter *writer);
+
+#endif
@@ -0,0 +1,240 @@
+#define _GNU_SOURCE  // st_mtim
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "zone_map.h"
+#include "disk_reader.h"
+
+// ========================================
+// 존 맵 모듈 (Zone Map Module)
+// - 첫 실행 시 orders.tbl을 한 번 스캔하여 청크별 최소/최대값을 <원본>.zonemap에 저장
+// - 이후 실행은 헤더 검사 후 청크 배열만 읽음 (SF 1 기준 약 160개, 수 KB)
+// ========================================
+
+#define ZONE_MAP_MAGIC 0x504D5A54u  // "TZMP"
+#define ZONE_MAP_VERSION 1
+#define ZONE_MAP_BUILD_BLOCK (64 * 1024 * 1024)
+#define ZONE_MAP_BUILD_BATCH 4096
+
+// 사이드카 헤더 (원본 크기/수정 시각과 청크 크기로 유효성 판단)
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    int64_t chunk_bytes;
+    int64_t source_size;
+    int64_t source_mtime_sec;
+    int64_t source_mtime_nsec;
+    int64_t count;
+} ZoneMapHeader;
+
+// ========================================
+// 1. 사이드카 경로 및 유효성 검사
+// ========================================
+
+static void zone_map_path(char *out, size_t size, const char *filename, const char *suffix) {
+    snprintf(out, size, "%s.%s", filename, suffix);
+}
+
+// 헤더가 원본 파일과 일치하면 1 반환 (fp는 청크 배열 시작 위치에 남음)
+static int header_is_valid(FILE *fp, const struct stat *st, ZoneMapHeader *header) {
+    return fread(header, sizeof(*header), 1, fp) == 1 &&
+           header->magic == ZONE_MAP_MAGIC &&
+           header->version == ZONE_MAP_VERSION &&
+           header->chunk_bytes == ZONE_MAP_CHUNK_BYTES &&
+           header->source_size == (int64_t)st->st_size &&
+           header->source_mtime_sec == (int64_t)st->st_mtim.tv_sec &&
+           header->source_mtime_nsec == (int64_t)st->st_mtim.tv_nsec &&
+           header->count >= 0;
+}
+
+// ========================================
+// 2. 존 맵 생성 (텍스트 스캔 1회 -> 청크별 최소/최대값 기록)
+// ========================================
+
+static void entry_add(ZoneMapEntry *entry, const OrderRecord *record) {
+    int date = zone_map_parse_date(record->orderdate, record->orderdate + strlen(record->orderdate));
+    if (record->custkey < entry->custkey_min) entry->custkey_min = record->custkey;
+    if (record->custkey > entry->custkey_max) entry->custkey_max = record->custkey;
+    if (date < entry->date_min) entry->date_min = date;
+    if (date > entry->date_max) entry->date_max = date;
+    if (record->totalprice < entry->price_min) entry->price_min = record->totalprice;
+    if (record->totalprice > entry->price_max) entry->price_max = record->totalprice;
+}
+
+static void entry_init(ZoneMapEntry *entry, long byte_start, long row_start, const OrderRecord *record) {
+    entry->byte_start = byte_start;
+    entry->row_start = row_start;
+    entry->custkey_min = entry->custkey_max = record->custkey;
+    entry->date_min = entry->date_max =
+        zone_map_parse_date(record->orderdate, record->orderdate + strlen(record->orderdate));
+    entry->price_min = entry->price_max = record->totalprice;
+}
+
+// 임시 파일에 기록한 뒤 이름 변경 (중단되어도 불완전한 존 맵을 쓰지 않음)
+static int build_zone_map(const char *filename) {
+    char path[1024], tmp[1024];
+    zone_map_path(path, sizeof(path), filename, "zonemap");
+    unlink(path);
+
+    struct stat st;
+    if (stat(filename, &st) != 0) {
+        perror("stat");
+        return -1;
+    }
+
+    DiskReader *reader = disk_reader_open_mode(filename, "order", ZONE_MAP_BUILD_BLOCK, DISK_READER_MODE_MMAP);
+    if (!reader) {
+        return -1;
+    }
+    disk_reader_set_columns(reader, ORDER_COL_CUSTKEY | ORDER_COL_ORDERDATE | ORDER_COL_TOTALPRICE);
+
+    // 청크 번호는 줄 시작 위치 / ZONE_MAP_CHUNK_BYTES이므로 개수는 이 값을 넘지 않음
+    long capacity = (long)(st.st_size / ZONE_MAP_CHUNK_BYTES) + 1;
+    ZoneMapEntry *entries = (ZoneMapEntry *)malloc(sizeof(ZoneMapEntry) * capacity);
+    OrderRecord *batch = (OrderRecord *)malloc(sizeof(OrderRecord) * ZONE_MAP_BUILD_BATCH);
+    if (!entries || !batch) {
+        fprintf(stderr, "존 맵 버퍼 할당 실패\n");
+        free(entries);
+        free(batch);
+        disk_reader_close(reader);
+        return -1;
+    }
+
+    long count = 0;
+    long rows = 0;
+    long chunk = -1;
+    int n;
+    while (disk_reader_read_orders_batch(reader, batch, ZONE_MAP_BUILD_BATCH, &n)) {
+        for (int i = 0; i < n; i++) {
+            long pos = disk_reader_order_locator(reader, i);
+            if (count == 0 || pos / ZONE_MAP_CHUNK_BYTES != chunk) {
+                // 새 청크: 이전 청크는 이 줄 앞에서 끝남 (첫 청크는 파일 처음부터)
+                long start = 0;
+                if (count > 0) {
+                    entries[count - 1].byte_end = pos;
+                    entries[count - 1].row_end = rows;
+                    start = pos;
+                }
+                entry_init(&entries[count++], start, rows, &batch[i]);
+                chunk = pos / ZONE_MAP_CHUNK_BYTES;
+            } else {
+                entry_add(&entries[count - 1], &batch[i]);
+            }
+            rows++;
+        }
+    }
+    disk_reader_close(reader);
+    free(batch);
+    if (count > 0) {
+        entries[count - 1].byte_end = st.st_size;
+        entries[count - 1].row_end = rows;
+    }
+
+    ZoneMapHeader header = {
+        .magic = ZONE_MAP_MAGIC,
+        .version = ZONE_MAP_VERSION,
+        .chunk_bytes = ZONE_MAP_CHUNK_BYTES,
+        .source_size = (int64_t)st.st_size,
+        .source_mtime_sec = (int64_t)st.st_mtim.tv_sec,
+        .source_mtime_nsec = (int64_t)st.st_mtim.tv_nsec,
+        .count = count,
+    };
+    zone_map_path(tmp, sizeof(tmp), filename, "zonemap.tmp");
+    FILE *fp = fopen(tmp, "wb");
+    int ok = fp != NULL &&
+             fwrite(&header, sizeof(header), 1, fp) == 1 &&
+             fwrite(entries, sizeof(ZoneMapEntry), count, fp) == (size_t)count;
+    if (fp && fclose(fp) != 0) ok = 0;
+    free(entries);
+    if (!ok || rename(tmp, path) != 0) {
+        perror("존 맵 기록 실패");
+        unlink(tmp);
+        return -1;
+    }
+
+    return 0;
+}
+
+int zone_map_prepare(const char *filename) {
+    struct stat st;
+    if (stat(filename, &st) != 0) {
+        perror("stat");
+        return -1;
+    }
+
+    char path[1024];
+    zone_map_path(path, sizeof(path), filename, "zonemap");
+    FILE *fp = fopen(path, "rb");
+    if (fp) {
+        ZoneMapHeader header;
+        int valid = header_is_valid(fp, &st, &header);
+        fclose(fp);
+        if (valid) {
+            return 0;
+        }
+    }
+
+    printf("존 맵 생성 중: %s\n", filename);
+    return build_zone_map(filename);
+}
+
+// ========================================
+// 3. 존 맵 읽기, 청크 탐색 및 정리
+// ========================================
+
+ZoneMap* zone_map_open(const char *filename) {
+    struct stat st;
+    if (stat(filename, &st) != 0) {
+        return NULL;
+    }
+
+    char path[1024];
+    zone_map_path(path, sizeof(path), filename, "zonemap");
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        return NULL;
+    }
+
+    ZoneMapHeader header;
+    ZoneMap *map = NULL;
+    if (header_is_valid(fp, &st, &header) && header.count > 0) {
+        map = (ZoneMap *)malloc(sizeof(ZoneMap));
+        ZoneMapEntry *entries = (ZoneMapEntry *)malloc(sizeof(ZoneMapEntry) * header.count);
+        if (map && entries && fread(entries, sizeof(ZoneMapEntry), header.count, fp) == (size_t)header.count) {
+            map->count = header.count;
+            map->entries = entries;
+        } else {
+            fprintf(stderr, "존 맵 읽기 실패: %s\n", path);
+            free(entries);
+            free(map);
+            map = NULL;
+        }
+    }
+    fclose(fp);
+    return map;
+}
+
+void zone_map_close(ZoneMap *map) {
+    if (map) {
+        free(map->entries);
+        free(map);
+    }
+}
+
+long zone_map_find(const ZoneMap *map, long pos, int by_row) {
+    // 시작 위치가 pos 이하인 마지막 청크 (이진 탐색)
+    long lo = 0;
+    long hi = map->count - 1;
+    while (lo < hi) {
+        long mid = lo + (hi - lo + 1) / 2;
+        long start = by_row ? map->entries[mid].row_start : map->entries[mid].byte_start;
+        if (start <= pos) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return lo;
+}
@@ -0,0 +1,61 @@
+#ifndef ZONE_MAP_H
+#define ZONE_MAP_H
+
+#include <stdint.h>
+#include "decimal.h"
+
+// ========================================
+// Orders 존 맵 (Zone Map) 사이드카
+// - 원본 .tbl을 ZONE_MAP_CHUNK_BYTES 단위 청크로 나누고 (경계는 다음 줄 시작)
+//   청크마다 O_CUSTKEY / O_ORDERDATE / O_TOTALPRICE의 최소/최대값을 기록
+// - 리더는 키 범위 필터나 주문 날짜 조건과 겹칠 수 없는 청크를 통째로 건너뜀
+// - 파일: <원본>.zonemap, 원본 크기/수정 시각이 다르면 자동 재생성 (컬럼 캐시와 동일)
+// ========================================
+
+#ifndef ZONE_MAP_CHUNK_BYTES
+#define ZONE_MAP_CHUNK_BYTES (1024 * 1024)
+#endif
+
+typedef struct {
+    int64_t byte_start;     // 청크 첫 줄의 파일 위치 (첫 청크는 0)
+    int64_t byte_end;       // 다음 청크 시작 (마지막 청크는 파일 끝)
+    int64_t row_start;      // 청크 첫 행 번호 (컬럼 캐시 행 번호와 같음)
+    int64_t row_end;
+    int64_t custkey_min;
+    int64_t custkey_max;
+    int32_t date_min;       // O_ORDERDATE (YYYYMMDD 정수)
+    int32_t date_max;
+    Decimal price_min;      // O_TOTALPRICE (센트 단위)
+    Decimal price_max;
+} ZoneMapEntry;
+
+typedef struct ZoneMap {
+    long count;
+    ZoneMapEntry *entries;  // 파일 순서, 빈틈 없이 이어짐
+} ZoneMap;
+
+// 존 맵이 없거나 원본이 바뀌었으면 (재)생성 (성공 0, 실패 -1)
+// 여러 스레드가 동시에 호출하지 않도록 병렬 영역 밖에서 한 번 호출
+int zone_map_prepare(const char *filename);
+
+// 유효한 존 맵을 메모리로 읽기 (없거나 오래되었으면 NULL)
+ZoneMap* zone_map_open(const char *filename);
+void zone_map_close(ZoneMap *map);
+
+// pos를 포함하는 청크 번호 (by_row: pos가 행 번호, 아니면 파일 바이트 위치)
+long zone_map_find(const ZoneMap *map, long pos, int by_row);
+
+// "YYYY-MM-DD" 구간 [p, end)를 YYYYMMDD 정수로 변환 (숫자만 최대 8자리 사용)
+static inline int zone_map_parse_date(const char *p, const char *end) {
+    int value = 0;
+    int digits = 0;
+    for (; p < end && digits < 8; p++) {
+        if (*p >= '0' && *p <= '9') {
+            value = value * 10 + (*p - '0');
+            digits++;
+        }
+    }
+    return value;
+}
+
+#endif